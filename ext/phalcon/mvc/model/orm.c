@@ -31,6 +31,414 @@
 #include <zend_smart_str.h>
 #endif
 
+/**
+ * Process-wide cache of parsed PHQL statements
+ *
+ * Entries live in persistent memory so they survive the request shutdown,
+ * the ASTs are deep-copied in and out of the cache to keep them isolated
+ * from the request allocator. The cache is not available in ZTS builds
+ */
+typedef struct _phalcon_orm_ast_entry {
+	unsigned long key;
+	char *phql;
+	unsigned int phql_length;
+#if PHP_VERSION_ID < 70000
+	zval *ast;
+#else
+	zval ast;
+#endif
+	struct _phalcon_orm_ast_entry *prev;
+	struct _phalcon_orm_ast_entry *next;
+} phalcon_orm_ast_entry;
+
+typedef struct _phalcon_orm_ast_cache {
+	HashTable *entries;
+	phalcon_orm_ast_entry *head;
+	phalcon_orm_ast_entry *tail;
+	unsigned long size;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+} phalcon_orm_ast_cache;
+
+#ifndef ZTS
+static phalcon_orm_ast_cache phalcon_orm_persistent_asts = { NULL, NULL, NULL, 0, 0, 0, 0 };
+#endif
+
+#if PHP_VERSION_ID < 70000
+
+static void phalcon_orm_persistent_zval_dtor(void *data)
+{
+	zval *zv = *((zval **) data);
+
+	switch (Z_TYPE_P(zv)) {
+
+		case IS_STRING:
+			pefree(Z_STRVAL_P(zv), 1);
+			break;
+
+		case IS_ARRAY:
+			zend_hash_destroy(Z_ARRVAL_P(zv));
+			pefree(Z_ARRVAL_P(zv), 1);
+			break;
+	}
+
+	pefree(zv, 1);
+}
+
+/**
+ * Copies an AST between the request and the persistent allocators
+ */
+static zval *phalcon_orm_copy_ast(zval *src, int persistent)
+{
+	zval *dst, *copy, **entry;
+	HashPosition pos;
+	char *str_key;
+	uint str_key_len;
+	ulong num_key;
+
+	if (persistent) {
+		dst = pemalloc(sizeof(zval), 1);
+		INIT_PZVAL(dst);
+	} else {
+		MAKE_STD_ZVAL(dst);
+	}
+
+	switch (Z_TYPE_P(src)) {
+
+		case IS_STRING:
+			Z_TYPE_P(dst) = IS_STRING;
+			Z_STRLEN_P(dst) = Z_STRLEN_P(src);
+			Z_STRVAL_P(dst) = pemalloc(Z_STRLEN_P(src) + 1, persistent);
+			memcpy(Z_STRVAL_P(dst), Z_STRVAL_P(src), Z_STRLEN_P(src) + 1);
+			break;
+
+		case IS_ARRAY:
+			if (persistent) {
+				Z_TYPE_P(dst) = IS_ARRAY;
+				Z_ARRVAL_P(dst) = pemalloc(sizeof(HashTable), 1);
+				zend_hash_init(Z_ARRVAL_P(dst), zend_hash_num_elements(Z_ARRVAL_P(src)), NULL, phalcon_orm_persistent_zval_dtor, 1);
+			} else {
+				array_init_size(dst, zend_hash_num_elements(Z_ARRVAL_P(src)));
+			}
+
+			zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(src), &pos);
+			while (zend_hash_get_current_data_ex(Z_ARRVAL_P(src), (void **) &entry, &pos) == SUCCESS) {
+				copy = phalcon_orm_copy_ast(*entry, persistent);
+				if (zend_hash_get_current_key_ex(Z_ARRVAL_P(src), &str_key, &str_key_len, &num_key, 0, &pos) == HASH_KEY_IS_STRING) {
+					zend_hash_update(Z_ARRVAL_P(dst), str_key, str_key_len, (void *) &copy, sizeof(zval *), NULL);
+				} else {
+					zend_hash_index_update(Z_ARRVAL_P(dst), num_key, (void *) &copy, sizeof(zval *), NULL);
+				}
+				zend_hash_move_forward_ex(Z_ARRVAL_P(src), &pos);
+			}
+			break;
+
+		default:
+			Z_TYPE_P(dst) = Z_TYPE_P(src);
+			dst->value = src->value;
+			break;
+	}
+
+	return dst;
+}
+
+#else
+
+static void phalcon_orm_persistent_zval_dtor(zval *zv)
+{
+	switch (Z_TYPE_P(zv)) {
+
+		case IS_STRING:
+			zend_string_free(Z_STR_P(zv));
+			break;
+
+		case IS_ARRAY:
+			zend_hash_destroy(Z_ARRVAL_P(zv));
+			pefree(Z_ARRVAL_P(zv), 1);
+			break;
+	}
+}
+
+/**
+ * Copies an AST between the request and the persistent allocators
+ */
+static void phalcon_orm_copy_ast(zval *dst, zval *src, int persistent)
+{
+	zend_string *str_key;
+	zend_ulong num_key;
+	zval *entry, copy;
+	HashTable *ht;
+
+	switch (Z_TYPE_P(src)) {
+
+		case IS_STRING:
+			ZVAL_NEW_STR(dst, zend_string_init(Z_STRVAL_P(src), Z_STRLEN_P(src), persistent));
+			break;
+
+		case IS_ARRAY:
+			if (persistent) {
+				ht = pemalloc(sizeof(HashTable), 1);
+				zend_hash_init(ht, zend_hash_num_elements(Z_ARRVAL_P(src)), NULL, phalcon_orm_persistent_zval_dtor, 1);
+				ZVAL_ARR(dst, ht);
+			} else {
+				array_init_size(dst, zend_hash_num_elements(Z_ARRVAL_P(src)));
+			}
+
+			ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(src), num_key, str_key, entry) {
+				phalcon_orm_copy_ast(&copy, entry, persistent);
+				if (str_key) {
+					zend_hash_str_update(Z_ARRVAL_P(dst), ZSTR_VAL(str_key), ZSTR_LEN(str_key), &copy);
+				} else {
+					zend_hash_index_update(Z_ARRVAL_P(dst), num_key, &copy);
+				}
+			} ZEND_HASH_FOREACH_END();
+			break;
+
+		default:
+			ZVAL_COPY_VALUE(dst, src);
+			break;
+	}
+}
+
+#endif
+
+#ifndef ZTS
+
+static void phalcon_orm_ast_cache_unlink(phalcon_orm_ast_entry *entry)
+{
+	phalcon_orm_ast_cache *cache = &phalcon_orm_persistent_asts;
+
+	if (entry->prev) {
+		entry->prev->next = entry->next;
+	} else {
+		cache->head = entry->next;
+	}
+
+	if (entry->next) {
+		entry->next->prev = entry->prev;
+	} else {
+		cache->tail = entry->prev;
+	}
+
+	entry->prev = NULL;
+	entry->next = NULL;
+}
+
+static void phalcon_orm_ast_cache_link(phalcon_orm_ast_entry *entry)
+{
+	phalcon_orm_ast_cache *cache = &phalcon_orm_persistent_asts;
+
+	entry->prev = NULL;
+	entry->next = cache->head;
+
+	if (cache->head) {
+		cache->head->prev = entry;
+	}
+
+	cache->head = entry;
+	if (!cache->tail) {
+		cache->tail = entry;
+	}
+}
+
+static void phalcon_orm_ast_cache_free_entry(phalcon_orm_ast_entry *entry)
+{
+	phalcon_orm_ast_cache *cache = &phalcon_orm_persistent_asts;
+
+	phalcon_orm_ast_cache_unlink(entry);
+	zend_hash_index_del(cache->entries, entry->key);
+
+	phalcon_orm_persistent_zval_dtor(&entry->ast);
+
+	pefree(entry->phql, 1);
+	pefree(entry, 1);
+	cache->size--;
+}
+
+static phalcon_orm_ast_entry *phalcon_orm_ast_cache_find(unsigned long phql_key, const char *phql, unsigned int phql_length)
+{
+	phalcon_orm_ast_cache *cache = &phalcon_orm_persistent_asts;
+#if PHP_VERSION_ID < 70000
+	phalcon_orm_ast_entry **entry;
+#else
+	phalcon_orm_ast_entry *entry;
+#endif
+
+	if (!cache->entries) {
+		return NULL;
+	}
+
+#if PHP_VERSION_ID < 70000
+	if (zend_hash_index_find(cache->entries, phql_key, (void **) &entry) == SUCCESS) {
+		if ((*entry)->phql_length == phql_length && !memcmp((*entry)->phql, phql, phql_length)) {
+			return *entry;
+		}
+	}
+#else
+	if ((entry = zend_hash_index_find_ptr(cache->entries, phql_key)) != NULL) {
+		if (entry->phql_length == phql_length && !memcmp(entry->phql, phql, phql_length)) {
+			return entry;
+		}
+	}
+#endif
+
+	return NULL;
+}
+
+#endif
+
+/**
+ * Copies a cached AST into the request memory, returns FAILURE if the
+ * statement isn't in the persistent cache
+ */
+int phalcon_orm_ast_cache_fetch(zval *result, unsigned long phql_key, const char *phql, unsigned int phql_length TSRMLS_DC)
+{
+#ifndef ZTS
+	phalcon_orm_ast_entry *entry;
+
+	entry = phalcon_orm_ast_cache_find(phql_key, phql, phql_length);
+	if (!entry) {
+		phalcon_orm_persistent_asts.misses++;
+		return FAILURE;
+	}
+
+	phalcon_orm_persistent_asts.hits++;
+
+	/**
+	 * Move the entry to the front of the LRU list
+	 */
+	if (phalcon_orm_persistent_asts.head != entry) {
+		phalcon_orm_ast_cache_unlink(entry);
+		phalcon_orm_ast_cache_link(entry);
+	}
+
+#if PHP_VERSION_ID < 70000
+	{
+		zval *copy = phalcon_orm_copy_ast(entry->ast, 0);
+		ZVAL_ZVAL(result, copy, 0, 1);
+	}
+#else
+	phalcon_orm_copy_ast(result, &entry->ast, 0);
+#endif
+
+	return SUCCESS;
+#else
+	return FAILURE;
+#endif
+}
+
+/**
+ * Stores a parsed AST in the persistent cache evicting the least recently
+ * used statements when the cache is full
+ */
+void phalcon_orm_ast_cache_store(zval *ast, unsigned long phql_key, const char *phql, unsigned int phql_length, long max_size TSRMLS_DC)
+{
+#ifndef ZTS
+	phalcon_orm_ast_cache *cache = &phalcon_orm_persistent_asts;
+	phalcon_orm_ast_entry *entry;
+
+	if (max_size <= 0 || Z_TYPE_P(ast) != IS_ARRAY) {
+		return;
+	}
+
+	if (phalcon_orm_ast_cache_find(phql_key, phql, phql_length)) {
+		return;
+	}
+
+	if (!cache->entries) {
+		cache->entries = pemalloc(sizeof(HashTable), 1);
+		zend_hash_init(cache->entries, 64, NULL, NULL, 1);
+	}
+
+	/**
+	 * A hash collision with a different statement replaces the old entry
+	 */
+#if PHP_VERSION_ID < 70000
+	{
+		phalcon_orm_ast_entry **collision;
+		if (zend_hash_index_find(cache->entries, phql_key, (void **) &collision) == SUCCESS) {
+			phalcon_orm_ast_cache_free_entry(*collision);
+		}
+	}
+#else
+	{
+		phalcon_orm_ast_entry *collision;
+		if ((collision = zend_hash_index_find_ptr(cache->entries, phql_key)) != NULL) {
+			phalcon_orm_ast_cache_free_entry(collision);
+		}
+	}
+#endif
+
+	while (cache->size >= (unsigned long) max_size && cache->tail) {
+		phalcon_orm_ast_cache_free_entry(cache->tail);
+		cache->evictions++;
+	}
+
+	entry = pemalloc(sizeof(phalcon_orm_ast_entry), 1);
+	entry->key = phql_key;
+	entry->phql = pemalloc(phql_length + 1, 1);
+	memcpy(entry->phql, phql, phql_length);
+	entry->phql[phql_length] = '\0';
+	entry->phql_length = phql_length;
+
+#if PHP_VERSION_ID < 70000
+	entry->ast = phalcon_orm_copy_ast(ast, 1);
+	zend_hash_index_update(cache->entries, phql_key, (void *) &entry, sizeof(phalcon_orm_ast_entry *), NULL);
+#else
+	phalcon_orm_copy_ast(&entry->ast, ast, 1);
+	zend_hash_index_update_ptr(cache->entries, phql_key, entry);
+#endif
+
+	phalcon_orm_ast_cache_link(entry);
+	cache->size++;
+#endif
+}
+
+/**
+ * Returns the counters of the persistent AST cache
+ */
+void phalcon_orm_ast_cache_stats(zval *return_value TSRMLS_DC)
+{
+	array_init(return_value);
+
+#ifndef ZTS
+	add_assoc_long(return_value, "size", phalcon_orm_persistent_asts.size);
+	add_assoc_long(return_value, "hits", phalcon_orm_persistent_asts.hits);
+	add_assoc_long(return_value, "misses", phalcon_orm_persistent_asts.misses);
+	add_assoc_long(return_value, "evictions", phalcon_orm_persistent_asts.evictions);
+#else
+	add_assoc_long(return_value, "size", 0);
+	add_assoc_long(return_value, "hits", 0);
+	add_assoc_long(return_value, "misses", 0);
+	add_assoc_long(return_value, "evictions", 0);
+#endif
+}
+
+/**
+ * Removes every statement from the persistent AST cache
+ */
+void phalcon_orm_ast_cache_clear(TSRMLS_D)
+{
+#ifndef ZTS
+	phalcon_orm_ast_cache *cache = &phalcon_orm_persistent_asts;
+
+	while (cache->head) {
+		phalcon_orm_ast_cache_free_entry(cache->head);
+	}
+
+	if (cache->entries) {
+		zend_hash_destroy(cache->entries);
+		pefree(cache->entries, 1);
+		cache->entries = NULL;
+	}
+
+	cache->hits = 0;
+	cache->misses = 0;
+	cache->evictions = 0;
+#endif
+}
+
 /**
  * Destroyes the prepared ASTs
  */
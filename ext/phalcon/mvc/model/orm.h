@@ -18,4 +18,8 @@
 */
 
 void phalcon_orm_destroy_cache(TSRMLS_D);
+int phalcon_orm_ast_cache_fetch(zval *result, unsigned long phql_key, const char *phql, unsigned int phql_length TSRMLS_DC);
+void phalcon_orm_ast_cache_store(zval *ast, unsigned long phql_key, const char *phql, unsigned int phql_length, long max_size TSRMLS_DC);
+void phalcon_orm_ast_cache_stats(zval *return_value TSRMLS_DC);
+void phalcon_orm_ast_cache_clear(TSRMLS_D);
 void phalcon_orm_singlequotes(zval *return_value, zval *str TSRMLS_DC);
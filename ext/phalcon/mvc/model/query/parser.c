@@ -4967,6 +4967,8 @@ void phql_(
   +------------------------------------------------------------------------+
 */
 
+#include "phalcon/mvc/model/orm.h"
+
 const phql_token_names phql_tokens[] =
 {
   { SL("INTEGER"),			   PHQL_T_INTEGER },
@@ -5119,6 +5121,40 @@ static void phql_scanner_error_msg(phql_parser_status *parser_status, zval **err
 	}
 }
 
+/**
+ * Stores a parsed AST in the request cache
+ */
+static void phql_cache_request_ast(zval **result, unsigned long phql_key TSRMLS_DC)
+{
+	zend_phalcon_globals *phalcon_globals_ptr = ZEPHIR_VGLOBAL;
+
+	if (!phalcon_globals_ptr->orm.parser_cache) {
+		ALLOC_HASHTABLE(phalcon_globals_ptr->orm.parser_cache);
+		zend_hash_init(phalcon_globals_ptr->orm.parser_cache, 0, NULL, ZVAL_PTR_DTOR, 0);
+	}
+
+#if PHP_VERSION_ID < 70000
+
+	Z_ADDREF_PP(result);
+
+	zend_hash_index_update(
+		phalcon_globals_ptr->orm.parser_cache,
+		phql_key,
+		result,
+		sizeof(zval *),
+		NULL
+	);
+#else
+	Z_TRY_ADDREF_P(*result);
+
+	zend_hash_index_update(
+		phalcon_globals_ptr->orm.parser_cache,
+		phql_key,
+		*result
+	);
+#endif
+}
+
 /**
  * Executes the internal PHQL parser/tokenizer
  */
@@ -5188,6 +5224,19 @@ int phql_internal_parse_phql(zval **result, char *phql, unsigned int phql_length
             }
 #endif
 		}
+
+		/**
+		 * Statements parsed by previous requests are kept in the persistent cache
+		 */
+		if (phalcon_globals_ptr->orm.persistent_ast_cache) {
+			if (phalcon_orm_ast_cache_fetch(*result, phql_key, phql, phql_length TSRMLS_CC) == SUCCESS) {
+				if (cache_level >= 1) {
+					add_assoc_long(*result, "id", phalcon_globals_ptr->orm.unique_cache_id++);
+				}
+				phql_cache_request_ast(result, phql_key TSRMLS_CC);
+				return SUCCESS;
+			}
+		}
 	}
 
 	phql_parser = phql_Alloc(phql_wrapper_alloc);
@@ -5607,6 +5656,18 @@ int phql_internal_parse_phql(zval **result, char *phql, unsigned int phql_length
 			if (Z_TYPE_P(&parser_status->ret) == IS_ARRAY) {
 #endif
 
+				/**
+				 * Store the parsed definition in the persistent cache before
+				 * the request-scoped unique id is assigned
+				 */
+				if (cache_level >= 0 && phalcon_globals_ptr->orm.persistent_ast_cache) {
+#if PHP_VERSION_ID < 70000
+					phalcon_orm_ast_cache_store(parser_status->ret, phql_key, phql, phql_length, phalcon_globals_ptr->orm.persistent_ast_cache_size TSRMLS_CC);
+#else
+					phalcon_orm_ast_cache_store(&parser_status->ret, phql_key, phql, phql_length, phalcon_globals_ptr->orm.persistent_ast_cache_size TSRMLS_CC);
+#endif
+				}
+
 				/**
 				 * Set a unique id for the parsed ast
 				 */
@@ -5634,32 +5695,7 @@ int phql_internal_parse_phql(zval **result, char *phql, unsigned int phql_length
 				 * Store the parsed definition in the cache
 				 */
 				if (cache_level >= 0) {
-
-                    if (!phalcon_globals_ptr->orm.parser_cache) {
-                        ALLOC_HASHTABLE(phalcon_globals_ptr->orm.parser_cache);
-                        zend_hash_init(phalcon_globals_ptr->orm.parser_cache, 0, NULL, ZVAL_PTR_DTOR, 0);
-                    }
-
-#if PHP_VERSION_ID < 70000
-
-					Z_ADDREF_PP(result);
-
-					zend_hash_index_update(
-						phalcon_globals_ptr->orm.parser_cache,
-						phql_key,
-						result,
-						sizeof(zval *),
-						NULL
-					);
-#else
-                    Z_TRY_ADDREF_P(*result);
-
-                    zend_hash_index_update(
-                        phalcon_globals_ptr->orm.parser_cache,
-                        phql_key,
-                        *result
-                    );
-#endif
+					phql_cache_request_ast(result, phql_key TSRMLS_CC);
 				}
 
 			} else {
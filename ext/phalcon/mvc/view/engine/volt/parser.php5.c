@@ -58,23 +58,23 @@
 **                       defined, then do no error processing.
 */
 #define YYCODETYPE unsigned char
-#define YYNOCODE 125
+#define YYNOCODE 126
 #define YYACTIONTYPE unsigned short int
 #define phvolt_TOKENTYPE phvolt_parser_token*
 typedef union {
   phvolt_TOKENTYPE yy0;
-  zval* yy40;
-  int yy249;
+  zval* yy158;
+  int yy251;
 } YYMINORTYPE;
 #define YYSTACKDEPTH 100
 #define phvolt_ARG_SDECL phvolt_parser_status *status;
 #define phvolt_ARG_PDECL ,phvolt_parser_status *status
 #define phvolt_ARG_FETCH phvolt_parser_status *status = yypParser->status
 #define phvolt_ARG_STORE yypParser->status = status
-#define YYNSTATE 348
-#define YYNRULE 152
+#define YYNSTATE 364
+#define YYNRULE 155
 #define YYERRORSYMBOL 85
-#define YYERRSYMDT yy249
+#define YYERRSYMDT yy251
 #define YY_NO_ACTION      (YYNSTATE+YYNRULE+2)
 #define YY_ACCEPT_ACTION  (YYNSTATE+YYNRULE+1)
 #define YY_ERROR_ACTION   (YYNSTATE+YYNRULE)
@@ -129,311 +129,322 @@ typedef union {
 static YYACTIONTYPE yy_action[] = {
  /*     0 */    83,   93,  109,   61,   53,   55,   67,   63,   65,   73,
  /*    10 */    75,   77,   79,   69,   71,   49,   47,   51,   44,   41,
- /*    20 */    57,   90,   59,   85,   88,   89,   97,   81,   86,  231,
- /*    30 */    85,   88,   89,   97,   81,  286,   44,   41,   57,   90,
- /*    40 */    59,   85,   88,   89,   97,   81,  108,  285,  180,  201,
+ /*    20 */    57,   90,   59,   85,   88,   89,   97,   81,  364,  231,
+ /*    30 */    85,   88,   89,   97,   81,  302,   44,   41,   57,   90,
+ /*    40 */    59,   85,   88,   89,   97,   81,  108,  301,  180,  201,
  /*    50 */   184,   83,   93,  182,   61,   53,   55,   67,   63,   65,
  /*    60 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*    70 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  223,
- /*    80 */   251,   83,   93,  181,   61,   53,   55,   67,   63,   65,
+ /*    70 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  330,
+ /*    80 */   174,   83,   93,  181,   61,   53,   55,   67,   63,   65,
  /*    90 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   100 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  314,
- /*   110 */   174,  321,  172,   37,   83,   93,  252,   61,   53,   55,
- /*   120 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
- /*   130 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
- /*   140 */    97,   81,  330,  325,   83,   93,  228,   61,   53,   55,
+ /*   100 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   31,
+ /*   110 */   251,   83,   93,   33,   61,   53,   55,   67,   63,   65,
+ /*   120 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
+ /*   130 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  346,
+ /*   140 */   341,  337,  172,   37,   83,   93,  252,   61,   53,   55,
  /*   150 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
  /*   160 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
- /*   170 */    97,   81,  279,  260,   83,   93,   95,   61,   53,   55,
+ /*   170 */    97,   81,   86,   27,   83,   93,  137,   61,   53,   55,
  /*   180 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
  /*   190 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
- /*   200 */    97,   81,   83,   93,  302,   61,   53,   55,   67,   63,
- /*   210 */    65,   73,   75,   77,   79,   69,   71,   49,   47,   51,
- /*   220 */    44,   41,   57,   90,   59,   85,   88,   89,   97,   81,
- /*   230 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   240 */    89,   97,   81,  304,  295,  313,  199,  103,  109,  346,
- /*   250 */   296,   83,   93,  205,   61,   53,   55,   67,   63,   65,
+ /*   200 */    97,   81,  129,   40,   83,   93,  138,   61,   53,   55,
+ /*   210 */    67,   63,   65,   73,   75,   77,   79,   69,   71,   49,
+ /*   220 */    47,   51,   44,   41,   57,   90,   59,   85,   88,   89,
+ /*   230 */    97,   81,   49,   47,   51,   44,   41,   57,   90,   59,
+ /*   240 */    85,   88,   89,   97,   81,  109,  116,   92,  128,  183,
+ /*   250 */   184,   83,   93,   95,   61,   53,   55,   67,   63,   65,
  /*   260 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   270 */    41,   57,   90,   59,   85,   88,   89,   97,   81,  129,
- /*   280 */   316,   83,   93,  145,   61,   53,   55,   67,   63,   65,
- /*   290 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   300 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   90,
- /*   310 */    59,   85,   88,   89,   97,   81,  307,  308,  309,  310,
- /*   320 */   311,  312,  183,  184,   92,  215,  262,  273,   83,   93,
- /*   330 */   113,   61,   53,   55,   67,   63,   65,   73,   75,   77,
+ /*   270 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   83,
+ /*   280 */    93,  499,   61,   53,   55,   67,   63,   65,   73,   75,
+ /*   290 */    77,   79,   69,   71,   49,   47,   51,   44,   41,   57,
+ /*   300 */    90,   59,   85,   88,   89,   97,   81,   90,   59,   85,
+ /*   310 */    88,   89,   97,   81,  323,  324,  325,  326,  327,  328,
+ /*   320 */   311,  329,  279,  295,  103,  262,  273,  113,   83,   93,
+ /*   330 */   500,   61,   53,   55,   67,   63,   65,   73,   75,   77,
  /*   340 */    79,   69,   71,   49,   47,   51,   44,   41,   57,   90,
- /*   350 */    59,   85,   88,   89,   97,   81,  140,  140,  224,  271,
- /*   360 */   284,   56,   91,  235,  143,  102,  216,  344,  139,  139,
- /*   370 */   414,  197,  141,  118,  118,   83,   93,  118,   61,   53,
+ /*   350 */    59,   85,   88,   89,   97,   81,  140,  140,  132,  133,
+ /*   360 */   186,  188,  142,  144,  143,  499,  145,  320,  139,  139,
+ /*   370 */   500,  197,  118,  118,  118,   83,   93,  205,   61,   53,
  /*   380 */    55,   67,   63,   65,   73,   75,   77,   79,   69,   71,
  /*   390 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   400 */    89,   97,   81,  171,   40,   83,   93,  415,   61,   53,
- /*   410 */    55,   67,   63,   65,   73,   75,   77,   79,   69,   71,
- /*   420 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   430 */    89,   97,   81,  237,   27,   83,   93,  481,   61,   53,
- /*   440 */    55,   67,   63,   65,   73,   75,   77,   79,   69,   71,
- /*   450 */    49,   47,   51,   44,   41,   57,   90,   59,   85,   88,
- /*   460 */    89,   97,   81,   83,   93,  320,   61,   53,   55,   67,
+ /*   400 */    89,   97,   81,   83,   93,  169,   61,   53,   55,   67,
+ /*   410 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
+ /*   420 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   430 */    81,  240,  248,   83,   93,  171,   61,   53,   55,   67,
+ /*   440 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
+ /*   450 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   460 */    81,  178,  254,   83,   93,  199,   61,   53,   55,   67,
  /*   470 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   480 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   490 */    81,  240,  332,   83,   93,  289,   61,   53,   55,   67,
+ /*   490 */    81,  200,  257,   83,   93,  203,   61,   53,   55,   67,
  /*   500 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   510 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   520 */    81,  200,  248,   83,   93,  169,   61,   53,   55,   67,
+ /*   520 */    81,  204,  260,   83,   93,  206,   61,   53,   55,   67,
  /*   530 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   540 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   550 */    81,  291,  254,   83,   93,  280,   61,   53,   55,   67,
+ /*   550 */    81,  210,  332,   83,   93,  216,   61,   53,   55,   67,
  /*   560 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   570 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   580 */    81,  339,  257,   83,   93,  292,   61,   53,   55,   67,
+ /*   580 */    81,  220,  348,   83,   93,  223,   61,   53,   55,   67,
  /*   590 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
- /*   600 */    51,   44,   41,   57,   90,   59,   85,   88,   89,  213,
- /*   610 */    81,   83,   93,  293,   61,   53,   55,   67,   63,   65,
+ /*   600 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
+ /*   610 */    81,   83,   93,  224,   61,   53,   55,   67,   63,   65,
  /*   620 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
- /*   630 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   93,
- /*   640 */   322,   61,   53,   55,   67,   63,   65,   73,   75,   77,
+ /*   630 */    41,   57,   90,   59,   85,   88,   89,  213,   81,   93,
+ /*   640 */   242,   61,   53,   55,   67,   63,   65,   73,   75,   77,
  /*   650 */    79,   69,   71,   49,   47,   51,   44,   41,   57,   90,
  /*   660 */    59,   85,   88,   89,   97,   81,   61,   53,   55,   67,
  /*   670 */    63,   65,   73,   75,   77,   79,   69,   71,   49,   47,
  /*   680 */    51,   44,   41,   57,   90,   59,   85,   88,   89,   97,
- /*   690 */    81,   53,   55,   67,   63,   65,   73,   75,   77,   79,
- /*   700 */    69,   71,   49,   47,   51,   44,   41,   57,   90,   59,
- /*   710 */    85,   88,   89,   97,   81,  501,    1,    2,  272,    4,
- /*   720 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*   730 */    15,   16,   17,   18,   19,   20,   21,   22,   23,   28,
+ /*   690 */    81,  520,    1,    2,  272,    4,    5,    6,    7,    8,
+ /*   700 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*   710 */    19,   20,   21,   22,   23,   53,   55,   67,   63,   65,
+ /*   720 */    73,   75,   77,   79,   69,   71,   49,   47,   51,   44,
+ /*   730 */    41,   57,   90,   59,   85,   88,   89,   97,   81,   28,
  /*   740 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
  /*   750 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*   760 */    23,  207,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*   760 */    23,   34,  272,    4,    5,    6,    7,    8,    9,   10,
  /*   770 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
  /*   780 */    21,   22,   23,   67,   63,   65,   73,   75,   77,   79,
  /*   790 */    69,   71,   49,   47,   51,   44,   41,   57,   90,   59,
- /*   800 */    85,   88,   89,   97,   81,  232,  272,    4,    5,    6,
+ /*   800 */    85,   88,   89,   97,   81,  175,  272,    4,    5,    6,
  /*   810 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
- /*   820 */    17,   18,   19,   20,   21,   22,   23,  264,  272,    4,
+ /*   820 */    17,   18,   19,   20,   21,   22,   23,  207,  272,    4,
  /*   830 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
  /*   840 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  217,
  /*   850 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
  /*   860 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*   870 */    23,  281,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*   870 */    23,  225,  272,    4,    5,    6,    7,    8,    9,   10,
  /*   880 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
- /*   890 */    21,   22,   23,  275,  272,    4,    5,    6,    7,    8,
+ /*   890 */    21,   22,   23,  232,  272,    4,    5,    6,    7,    8,
  /*   900 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
- /*   910 */    19,   20,   21,   22,   23,  333,  272,    4,    5,    6,
+ /*   910 */    19,   20,   21,   22,   23,  264,  272,    4,    5,    6,
  /*   920 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
- /*   930 */    17,   18,   19,   20,   21,   22,   23,  175,  272,    4,
+ /*   930 */    17,   18,   19,   20,   21,   22,   23,  275,  272,    4,
  /*   940 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*   950 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  298,
+ /*   950 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  281,
  /*   960 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
  /*   970 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*   980 */    23,  317,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*   980 */    23,  287,  272,    4,    5,    6,    7,    8,    9,   10,
  /*   990 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
- /*  1000 */    21,   22,   23,  326,  272,    4,    5,    6,    7,    8,
+ /*  1000 */    21,   22,   23,  297,  272,    4,    5,    6,    7,    8,
  /*  1010 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
- /*  1020 */    19,   20,   21,   22,   23,   34,  272,    4,    5,    6,
+ /*  1020 */    19,   20,   21,   22,   23,  314,  272,    4,    5,    6,
  /*  1030 */     7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
- /*  1040 */    17,   18,   19,   20,   21,   22,   23,  225,  272,    4,
+ /*  1040 */    17,   18,   19,   20,   21,   22,   23,  333,  272,    4,
  /*  1050 */     5,    6,    7,    8,    9,   10,   11,   12,   13,   14,
- /*  1060 */    15,   16,   17,   18,   19,   20,   21,   22,   23,    3,
- /*  1070 */     4,    5,    6,    7,    8,    9,   10,   11,   12,   13,
- /*  1080 */    14,   15,   16,   17,   18,   19,   20,   21,   22,   23,
- /*  1090 */   241,    4,    5,    6,    7,    8,    9,   10,   11,   12,
- /*  1100 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*  1110 */    23,   25,  221,  341,  343,   38,  168,  170,   98,  294,
- /*  1120 */   179,  349,   24,  105,  480,  127,   98,  202,  242,   24,
- /*  1130 */   118,  135,  107,  214,  114,  118,  211,  340,  118,  135,
- /*  1140 */   222,  263,  229,   26,  236,  105,  246,  249,  167,  255,
- /*  1150 */   258,  261,  196,  268,  270,  118,  126,  118,   45,   42,
- /*  1160 */   118,  104,   70,   99,  118,   29,  101,  243,   45,   42,
- /*  1170 */   117,  104,  105,   99,  118,  119,  101,  323,  297,  238,
- /*  1180 */   336,  112,  118,  114,  118,  119,  238,  120,  121,  122,
- /*  1190 */   123,  124,  125,   98,  238,  239,  245,  120,  121,  122,
- /*  1200 */   123,  124,  125,  245,  337,  118,  130,  118,  176,   68,
- /*  1210 */   345,  245,  129,  155,  156,  157,  158,  159,  160,  161,
- /*  1220 */   110,  118,  238,  148,  149,  150,  151,  152,  153,  154,
- /*  1230 */   110,   25,  221,   30,   32,   38,  168,  170,  244,  245,
- /*  1240 */   179,   58,  173,  247,  348,   54,  203,  202,  204,  301,
- /*  1250 */   481,  304,  342,  118,  118,  118,  211,  118,  128,   31,
- /*  1260 */   222,  238,  229,   35,  236,  238,  246,  249,  208,  255,
- /*  1270 */   258,  261,  218,  268,  270,   33,  303,  250,  245,   25,
- /*  1280 */   221,  195,  245,   38,  168,  170,  206,  198,  179,  118,
- /*  1290 */   287,  137,  305,   72,   39,  202,  144,  306,  185,  187,
- /*  1300 */   189,  191,  193,  116,  211,  118,  118,  138,  222,  227,
- /*  1310 */   229,  226,  236,  178,  246,  249,  233,  255,  258,  261,
- /*  1320 */   238,  268,  270,  347,  220,  238,  274,   25,  221,  238,
- /*  1330 */   132,   38,  168,  170,  210,  265,  179,  245,  276,  253,
- /*  1340 */   267,  212,  245,  202,  142,  256,  245,  238,  282,  480,
- /*  1350 */   329,  118,  211,  118,  278,  269,  222,  118,  229,  234,
- /*  1360 */   236,  278,  246,  249,  245,  255,  258,  261,  238,  268,
- /*  1370 */   270,  278,  278,  238,  278,   25,  221,   36,  278,   38,
- /*  1380 */   168,  170,  278,  299,  179,  245,  318,  278,  278,   64,
- /*  1390 */   245,  202,  238,  278,  327,  238,  334,  278,  278,  278,
- /*  1400 */   211,  118,  278,  278,  222,  238,  229,  278,  236,  245,
- /*  1410 */   246,  249,  245,  255,  258,  261,  278,  268,  270,  278,
- /*  1420 */   278,  163,  245,   25,  221,  278,  315,   38,  168,  170,
- /*  1430 */   259,  335,  179,  118,  278,  278,  278,  278,  118,  202,
- /*  1440 */   238,  278,  118,  238,  278,  278,  278,  278,  211,  278,
- /*  1450 */   278,  238,  222,  238,  229,  278,  236,  245,  246,  249,
- /*  1460 */   245,  255,  258,  261,  278,  268,  270,   76,  245,   66,
- /*  1470 */   245,   25,  221,   62,  324,   38,  168,  170,  165,  118,
- /*  1480 */   179,  118,  278,  278,  278,  118,  118,  202,  278,  278,
- /*  1490 */   118,   52,  278,  278,  278,  278,  211,  219,  278,  278,
- /*  1500 */   222,  278,  229,  118,  236,  278,  246,  249,  278,  255,
- /*  1510 */   258,  261,  278,  268,  270,  186,  278,  133,  278,   25,
- /*  1520 */   221,   50,  331,   38,  168,  170,  188,  118,  179,  118,
- /*  1530 */   278,  278,  278,  118,  118,  202,  278,   60,  118,  278,
- /*  1540 */   278,   87,  278,  278,  211,  278,  278,  278,  222,  118,
- /*  1550 */   229,  283,  236,  118,  246,  249,  278,  255,  258,  261,
- /*  1560 */   278,  268,  270,   48,  278,  190,  278,   25,  221,   46,
- /*  1570 */   192,   38,  168,  170,  166,  118,  179,  118,   94,   84,
- /*  1580 */   278,  118,  118,  202,  278,   96,  118,  230,  278,   74,
- /*  1590 */   118,  118,  211,  278,  278,  278,  222,  118,  229,  118,
- /*  1600 */   236,  118,  246,  249,  278,  255,  258,  261,  277,  268,
- /*  1610 */   270,   82,  278,   80,  194,   25,  221,  338,  100,   38,
- /*  1620 */   168,  170,   78,  118,  179,  118,  118,  278,  278,  278,
- /*  1630 */   118,  202,  278,   43,  118,  278,  278,  278,  278,  278,
- /*  1640 */   211,  278,  278,  278,  222,  118,  229,  278,  236,  278,
- /*  1650 */   246,  249,  278,  255,  258,  261,  278,  268,  270,  278,
- /*  1660 */   278,  278,  278,   25,  221,  278,  278,   38,  168,  170,
- /*  1670 */   278,  278,  179,  278,  278,  278,  278,  278,  278,  202,
- /*  1680 */   278,  209,  278,  278,  278,  278,  278,  278,  211,  278,
- /*  1690 */   278,  278,  222,  278,  229,  278,  236,  278,  246,  249,
- /*  1700 */   278,  255,  258,  261,  278,  268,  270,  278,  278,  278,
- /*  1710 */   278,   25,  221,  278,  278,   38,  168,  170,  278,  278,
- /*  1720 */   179,  278,  278,  278,  278,  278,  278,  202,  278,  278,
- /*  1730 */   278,  278,  278,  278,  278,  278,  211,  278,  278,  278,
- /*  1740 */   222,  288,  229,  278,  236,  278,  246,  249,  278,  255,
- /*  1750 */   258,  261,  278,  268,  270,  278,  278,  278,  278,   25,
- /*  1760 */   221,  278,  278,   38,  168,  170,  278,  278,  179,  278,
- /*  1770 */   278,  278,  278,  278,  278,  202,  278,  278,  278,  278,
- /*  1780 */   278,  278,  278,  278,  211,  278,  278,  278,  222,  278,
- /*  1790 */   229,  278,  236,  278,  246,  249,  278,  255,  258,  261,
- /*  1800 */   266,  268,  270,  278,  278,  278,  278,   25,  221,  278,
- /*  1810 */   278,   38,  168,  170,  278,  328,  179,  278,  278,  278,
- /*  1820 */   278,  278,  278,  202,  278,  278,  278,  278,  278,  278,
- /*  1830 */   278,  278,  211,  278,  278,  278,  222,  278,  229,  278,
- /*  1840 */   236,  278,  246,  249,  278,  255,  258,  261,  278,  268,
- /*  1850 */   270,  278,  278,  278,  278,   25,  221,  278,  278,   38,
- /*  1860 */   168,  170,  278,  278,  179,  278,  278,  278,  278,  278,
- /*  1870 */   278,  202,  278,  300,  278,  278,  278,  278,  278,  278,
- /*  1880 */   211,  278,  278,  278,  222,  278,  229,  278,  236,  278,
- /*  1890 */   246,  249,  278,  255,  258,  261,  278,  268,  270,  278,
- /*  1900 */   278,  278,  278,   25,  221,  278,  278,   38,  168,  170,
- /*  1910 */   278,  177,  179,  278,  278,  278,  278,  278,  278,  202,
- /*  1920 */   278,  278,  278,  278,  278,  278,  278,  278,  211,  278,
- /*  1930 */   278,  278,  222,  278,  229,  278,  236,  278,  246,  249,
- /*  1940 */   278,  255,  258,  261,  278,  268,  270,  278,  278,  278,
- /*  1950 */   278,   25,  221,  278,  278,   38,  168,  170,  278,  319,
- /*  1960 */   179,  278,  278,  278,  278,  278,  278,  202,  278,  278,
- /*  1970 */   278,  278,  278,  278,  278,  278,  211,  278,  278,  278,
- /*  1980 */   222,  278,  229,  278,  236,  278,  246,  249,  278,  255,
- /*  1990 */   258,  261,  278,  268,  270,  278,  278,  278,  278,   25,
- /*  2000 */   221,  278,  278,   38,  168,  170,  278,  278,  179,  278,
- /*  2010 */   278,  278,  278,  278,  278,  202,  278,  278,  278,  278,
- /*  2020 */   278,  278,  278,  278,  211,  278,  278,  278,  222,  278,
- /*  2030 */   229,  278,  236,  278,  246,  249,  278,  255,  258,  261,
- /*  2040 */   278,  268,  270,  278,  164,  278,   45,   42,  278,  104,
- /*  2050 */   136,   99,  278,  162,  101,  278,   45,   42,  278,  104,
- /*  2060 */   278,   99,  278,  119,  101,  278,   45,   42,  278,  104,
- /*  2070 */   278,   99,  278,  119,  101,  120,  121,  122,  123,  124,
- /*  2080 */   125,  278,  278,  147,  278,  120,  121,  122,  123,  124,
- /*  2090 */   125,  278,  278,  278,  278,  146,  121,  122,  123,  124,
- /*  2100 */   125,  278,   45,   42,  278,  104,  278,   99,  110,  278,
- /*  2110 */   101,  278,   45,   42,  278,  104,  278,   99,  110,  119,
- /*  2120 */   101,  278,  278,  278,  278,  278,  278,  106,  110,  119,
- /*  2130 */   278,  120,  115,  122,  123,  124,  125,  278,  278,  134,
- /*  2140 */   278,  120,  131,  122,  123,  124,  125,  278,  278,   45,
- /*  2150 */    42,  278,  104,  278,   99,   45,   42,  101,  104,  278,
- /*  2160 */    99,  278,  278,  101,  110,  278,  119,  278,  278,  278,
- /*  2170 */   278,  278,  119,  278,  110,  278,  290,  278,  120,  131,
- /*  2180 */   122,  123,  124,  125,  120,  115,  122,  123,  124,  125,
- /*  2190 */   278,  278,  278,  278,  278,  278,   45,   42,  278,  104,
- /*  2200 */   278,   99,   45,   42,  101,  104,  278,   99,  278,  278,
- /*  2210 */   101,  110,  278,  119,  278,  278,  278,  110,  111,  119,
- /*  2220 */   278,  278,  278,  278,  278,  120,  121,  122,  123,  124,
- /*  2230 */   125,  120,  115,  122,  123,  124,  125,  278,  278,   45,
- /*  2240 */    42,  278,  104,  278,   99,  278,  278,  101,  278,  278,
- /*  2250 */   278,  278,  278,  278,  278,  278,  119,  278,  110,  278,
- /*  2260 */   278,  278,  278,  278,  110,  278,  278,  278,  120,  131,
- /*  2270 */   122,  123,  124,  125,  278,  278,  278,  278,  278,  278,
- /*  2280 */   278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
- /*  2290 */   278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
- /*  2300 */   278,  110,
+ /*  1060 */    15,   16,   17,   18,   19,   20,   21,   22,   23,  342,
+ /*  1070 */   272,    4,    5,    6,    7,    8,    9,   10,   11,   12,
+ /*  1080 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
+ /*  1090 */    23,  349,  272,    4,    5,    6,    7,    8,    9,   10,
+ /*  1100 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
+ /*  1110 */    21,   22,   23,    3,    4,    5,    6,    7,    8,    9,
+ /*  1120 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*  1130 */    20,   21,   22,   23,  241,    4,    5,    6,    7,    8,
+ /*  1140 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*  1150 */    19,   20,   21,   22,   23,   25,  221,   30,   32,   38,
+ /*  1160 */   168,  170,   98,  228,  179,  365,   24,  280,   91,  127,
+ /*  1170 */   105,  202,   26,  291,  235,  118,  135,  237,  109,  141,
+ /*  1180 */   211,  118,  126,  118,  222,  118,  229,   98,  236,  244,
+ /*  1190 */   246,  249,  263,  255,  258,  261,  105,  268,  270,  243,
+ /*  1200 */   118,  130,   45,   42,  285,  104,  107,   99,  114,  118,
+ /*  1210 */   101,  267,   45,   42,  105,  104,  269,   99,  271,  119,
+ /*  1220 */   101,  274,  294,  238,  112,   39,  114,  118,   24,  119,
+ /*  1230 */   278,  120,  121,  122,  123,  124,  125,  105,  118,  284,
+ /*  1240 */   245,  120,  121,  122,  123,  124,  125,  293,  356,  114,
+ /*  1250 */   118,  129,   29,  167,  286,  318,  290,  155,  156,  157,
+ /*  1260 */   158,  159,  160,  161,  110,  292,  118,  148,  149,  150,
+ /*  1270 */   151,  152,  153,  154,  110,   25,  221,  357,  359,   38,
+ /*  1280 */   168,  170,   98,  353,  179,  238,   35,  434,  296,  214,
+ /*  1290 */    43,  202,  308,  300,  305,  118,  135,  215,  307,  309,
+ /*  1300 */   211,  312,  245,  118,  222,  238,  229,  176,  236,  238,
+ /*  1310 */   246,  249,  208,  255,  258,  261,  218,  268,  270,  310,
+ /*  1320 */   166,  313,  245,   25,  221,   36,  245,   38,  168,  170,
+ /*  1330 */   317,  303,  179,  118,  226,  320,   46,  321,   48,  202,
+ /*  1340 */   238,  322,  233,  238,  265,  319,  336,  338,  211,  118,
+ /*  1350 */   339,  118,  222,  345,  229,   50,  236,  245,  246,  249,
+ /*  1360 */   245,  255,  258,  261,  238,  268,  270,  352,  118,  238,
+ /*  1370 */    52,   25,  221,  238,  355,   38,  168,  170,  358,  177,
+ /*  1380 */   179,  245,   54,  118,   56,   58,  245,  202,  238,  360,
+ /*  1390 */   245,  238,  276,  361,  362,  118,  211,  118,  118,  238,
+ /*  1400 */   222,  238,  229,  282,  236,  245,  246,  249,  245,  255,
+ /*  1410 */   258,  261,  288,  268,  270,  363,  245,  282,  245,   25,
+ /*  1420 */   221,  195,  282,   38,  168,  170,  282,  198,  179,  282,
+ /*  1430 */   298,  282,  282,   60,   62,  202,  282,  209,  185,  187,
+ /*  1440 */   189,  191,  193,  282,  211,  282,  118,  118,  222,  238,
+ /*  1450 */   229,  315,  236,  282,  246,  249,  334,  255,  258,  261,
+ /*  1460 */   238,  268,  270,  282,  282,  282,  245,   25,  221,  238,
+ /*  1470 */   282,   38,  168,  170,  282,  343,  179,  245,  350,  282,
+ /*  1480 */   282,   64,   66,  202,   68,  282,  245,  238,   70,  282,
+ /*  1490 */   282,  282,  211,  219,  118,  118,  222,  118,  229,   72,
+ /*  1500 */   236,  118,  246,  249,  245,  255,  258,  261,  238,  268,
+ /*  1510 */   270,  282,  118,  238,   74,   25,  221,  282,  282,   38,
+ /*  1520 */   168,  170,  282,   76,  179,  245,  282,  118,  282,   78,
+ /*  1530 */   245,  202,  238,  282,   80,  238,  118,  282,  282,  282,
+ /*  1540 */   211,  282,  118,  282,  222,  227,  229,  118,  236,  245,
+ /*  1550 */   246,  249,  245,  255,  258,  261,  282,  268,  270,  282,
+ /*  1560 */   282,   82,   84,   25,  221,  282,  282,   38,  168,  170,
+ /*  1570 */    87,   94,  179,   96,  118,  118,  282,  100,  102,  202,
+ /*  1580 */   117,  282,  282,  118,  118,  282,  118,  282,  211,  282,
+ /*  1590 */   118,  118,  222,  118,  229,  234,  236,  163,  246,  249,
+ /*  1600 */   282,  255,  258,  261,  282,  268,  270,  282,  165,  173,
+ /*  1610 */   118,   25,  221,  190,  282,   38,  168,  170,  192,  194,
+ /*  1620 */   179,  118,  118,  282,  196,  212,  118,  202,  282,  282,
+ /*  1630 */   230,  118,  118,  282,  282,  239,  211,  118,  118,  282,
+ /*  1640 */   222,  282,  229,  118,  236,  247,  246,  249,  118,  255,
+ /*  1650 */   258,  261,  266,  268,  270,  282,  250,  253,  118,   25,
+ /*  1660 */   221,  256,  282,   38,  168,  170,  259,  282,  179,  118,
+ /*  1670 */   118,  282,  331,  340,  118,  202,  282,  282,  347,  118,
+ /*  1680 */   282,  282,  282,  282,  211,  118,  118,  282,  222,  282,
+ /*  1690 */   229,  118,  236,  282,  246,  249,  282,  255,  258,  261,
+ /*  1700 */   277,  268,  270,  282,  282,  282,  282,   25,  221,  282,
+ /*  1710 */   282,   38,  168,  170,  282,  282,  179,  282,  282,  282,
+ /*  1720 */   282,  282,  282,  202,  282,  282,  282,  282,  282,  282,
+ /*  1730 */   282,  282,  211,  282,  282,  282,  222,  282,  229,  283,
+ /*  1740 */   236,  282,  246,  249,  282,  255,  258,  261,  282,  268,
+ /*  1750 */   270,  282,  282,  282,  282,   25,  221,  282,  282,   38,
+ /*  1760 */   168,  170,  282,  282,  179,  282,  282,  282,  282,  282,
+ /*  1770 */   282,  202,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  1780 */   211,  282,  282,  282,  222,  282,  229,  289,  236,  282,
+ /*  1790 */   246,  249,  282,  255,  258,  261,  282,  268,  270,  282,
+ /*  1800 */   282,  282,  282,   25,  221,  282,  282,   38,  168,  170,
+ /*  1810 */   282,  282,  179,  282,  282,  282,  282,  282,  282,  202,
+ /*  1820 */   282,  282,  282,  282,  282,  282,  282,  282,  211,  282,
+ /*  1830 */   282,  282,  222,  282,  229,  299,  236,  282,  246,  249,
+ /*  1840 */   282,  255,  258,  261,  282,  268,  270,  282,  282,  282,
+ /*  1850 */   282,   25,  221,  282,  282,   38,  168,  170,  282,  282,
+ /*  1860 */   179,  282,  282,  282,  282,  282,  282,  202,  282,  282,
+ /*  1870 */   282,  282,  282,  282,  282,  282,  211,  282,  282,  282,
+ /*  1880 */   222,  304,  229,  282,  236,  282,  246,  249,  282,  255,
+ /*  1890 */   258,  261,  282,  268,  270,  282,  282,  282,  282,   25,
+ /*  1900 */   221,  282,  282,   38,  168,  170,  282,  282,  179,  282,
+ /*  1910 */   282,  282,  282,  282,  282,  202,  282,  316,  282,  282,
+ /*  1920 */   282,  282,  282,  282,  211,  282,  282,  282,  222,  282,
+ /*  1930 */   229,  282,  236,  282,  246,  249,  282,  255,  258,  261,
+ /*  1940 */   282,  268,  270,  282,  282,  282,  282,   25,  221,  282,
+ /*  1950 */   282,   38,  168,  170,  282,  335,  179,  282,  282,  282,
+ /*  1960 */   282,  282,  282,  202,  282,  282,  282,  282,  282,  282,
+ /*  1970 */   282,  282,  211,  282,  282,  282,  222,  282,  229,  282,
+ /*  1980 */   236,  282,  246,  249,  282,  255,  258,  261,  282,  268,
+ /*  1990 */   270,  282,  282,  282,  282,   25,  221,  282,  282,   38,
+ /*  2000 */   168,  170,  282,  344,  179,  282,  282,  282,  282,  282,
+ /*  2010 */   282,  202,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  2020 */   211,  282,  282,  282,  222,  282,  229,  282,  236,  282,
+ /*  2030 */   246,  249,  282,  255,  258,  261,  282,  268,  270,  282,
+ /*  2040 */   282,  282,  282,   25,  221,  282,  282,   38,  168,  170,
+ /*  2050 */   282,  351,  179,  282,  282,  282,  282,  282,  282,  202,
+ /*  2060 */   282,  282,  282,  282,  282,  282,  282,  282,  211,  282,
+ /*  2070 */   282,  282,  222,  282,  229,  282,  236,  282,  246,  249,
+ /*  2080 */   282,  255,  258,  261,  282,  268,  270,  282,  282,  282,
+ /*  2090 */   282,   25,  221,  354,  282,   38,  168,  170,  282,  282,
+ /*  2100 */   179,  282,  282,  282,  282,  282,  282,  202,  282,  282,
+ /*  2110 */   282,  282,  282,  282,  282,  282,  211,  282,  282,  282,
+ /*  2120 */   222,  282,  229,  282,  236,  282,  246,  249,  282,  255,
+ /*  2130 */   258,  261,  282,  268,  270,  282,  282,  282,  282,   25,
+ /*  2140 */   221,  282,  282,   38,  168,  170,  282,  282,  179,  282,
+ /*  2150 */   282,  282,  282,  282,  282,  202,  282,  282,  282,  282,
+ /*  2160 */   282,  282,  282,  282,  211,  282,  282,  282,  222,  282,
+ /*  2170 */   229,  282,  236,  282,  246,  249,  282,  255,  258,  261,
+ /*  2180 */   282,  268,  270,  282,  164,  282,   45,   42,  282,  104,
+ /*  2190 */   136,   99,  282,  162,  101,  282,   45,   42,  282,  104,
+ /*  2200 */   282,   99,  282,  119,  101,  282,   45,   42,  282,  104,
+ /*  2210 */   282,   99,  282,  119,  101,  120,  121,  122,  123,  124,
+ /*  2220 */   125,  282,  282,  147,  282,  120,  121,  122,  123,  124,
+ /*  2230 */   125,  282,  282,  282,  282,  146,  121,  122,  123,  124,
+ /*  2240 */   125,  282,   45,   42,  282,  104,  282,   99,  110,  282,
+ /*  2250 */   101,  282,  282,  282,  282,  282,  282,  282,  110,  119,
+ /*  2260 */   282,  282,   45,   42,  282,  104,  282,   99,  110,  134,
+ /*  2270 */   101,  120,  131,  122,  123,  124,  125,  282,  282,  119,
+ /*  2280 */    45,   42,  282,  104,  282,   99,  282,  106,  101,  282,
+ /*  2290 */   282,  120,  115,  122,  123,  124,  125,  119,   45,   42,
+ /*  2300 */   282,  104,  282,   99,  110,  282,  101,  282,  282,  120,
+ /*  2310 */   115,  122,  123,  124,  125,  119,  282,  282,   45,   42,
+ /*  2320 */   282,  104,  282,   99,  110,  306,  101,  120,  131,  122,
+ /*  2330 */   123,  124,  125,  282,  282,  119,   45,   42,  282,  104,
+ /*  2340 */   282,   99,  110,  111,  101,  282,  282,  120,  121,  122,
+ /*  2350 */   123,  124,  125,  119,   45,   42,  282,  104,  282,   99,
+ /*  2360 */   110,  282,  101,  282,  282,  120,  115,  122,  123,  124,
+ /*  2370 */   125,  119,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  2380 */   110,  282,  282,  120,  131,  122,  123,  124,  125,  282,
+ /*  2390 */   282,  282,  282,  282,  282,  282,  282,  282,  110,  282,
+ /*  2400 */   282,  282,  282,  282,  282,  282,  282,  282,  282,  282,
+ /*  2410 */   282,  282,  282,  282,  282,  282,  110,
 };
 static YYCODETYPE yy_lookahead[] = {
  /*     0 */     3,    4,    2,    6,    7,    8,    9,   10,   11,   12,
  /*    10 */    13,   14,   15,   16,   17,   18,   19,   20,   21,   22,
- /*    20 */    23,   24,   25,   26,   27,   28,   29,   30,    3,   32,
+ /*    20 */    23,   24,   25,   26,   27,   28,   29,   30,    0,   32,
  /*    30 */    26,   27,   28,   29,   30,   38,   21,   22,   23,   24,
  /*    40 */    25,   26,   27,   28,   29,   30,   46,   50,  111,  112,
  /*    50 */   113,    3,    4,    2,    6,    7,    8,    9,   10,   11,
  /*    60 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*    70 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   38,
+ /*    70 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
  /*    80 */    32,    3,    4,   32,    6,    7,    8,    9,   10,   11,
  /*    90 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*   100 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
- /*   110 */    32,    2,    3,   32,    3,    4,   68,    6,    7,    8,
- /*   120 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
- /*   130 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
- /*   140 */    29,   30,   31,   32,    3,    4,   32,    6,    7,    8,
+ /*   100 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   32,
+ /*   110 */    32,    3,    4,   32,    6,    7,    8,    9,   10,   11,
+ /*   120 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
+ /*   130 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+ /*   140 */    32,    2,    3,   32,    3,    4,   68,    6,    7,    8,
  /*   150 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
  /*   160 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
- /*   170 */    29,   30,  118,   32,    3,    4,    5,    6,    7,    8,
+ /*   170 */    29,   30,    3,   32,    3,    4,  121,    6,    7,    8,
  /*   180 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
  /*   190 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
- /*   200 */    29,   30,    3,    4,    2,    6,    7,    8,    9,   10,
- /*   210 */    11,   12,   13,   14,   15,   16,   17,   18,   19,   20,
- /*   220 */    21,   22,   23,   24,   25,   26,   27,   28,   29,   30,
- /*   230 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   240 */    28,   29,   30,   38,  114,  115,   38,   48,    2,   33,
- /*   250 */    48,    3,    4,   48,    6,    7,    8,    9,   10,   11,
+ /*   200 */    29,   30,    2,   32,    3,    4,   46,    6,    7,    8,
+ /*   210 */     9,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+ /*   220 */    19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
+ /*   230 */    29,   30,   18,   19,   20,   21,   22,   23,   24,   25,
+ /*   240 */    26,   27,   28,   29,   30,    2,    5,   46,   48,  112,
+ /*   250 */   113,    3,    4,    5,    6,    7,    8,    9,   10,   11,
  /*   260 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*   270 */    22,   23,   24,   25,   26,   27,   28,   29,   30,    2,
- /*   280 */    32,    3,    4,   46,    6,    7,    8,    9,   10,   11,
- /*   290 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
- /*   300 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   24,
- /*   310 */    25,   26,   27,   28,   29,   30,   50,   51,   52,   53,
- /*   320 */    54,   55,  112,  113,   46,   48,   54,   55,    3,    4,
- /*   330 */    84,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*   270 */    22,   23,   24,   25,   26,   27,   28,   29,   30,    3,
+ /*   280 */     4,   46,    6,    7,    8,    9,   10,   11,   12,   13,
+ /*   290 */    14,   15,   16,   17,   18,   19,   20,   21,   22,   23,
+ /*   300 */    24,   25,   26,   27,   28,   29,   30,   24,   25,   26,
+ /*   310 */    27,   28,   29,   30,   50,   51,   52,   53,   54,   55,
+ /*   320 */   114,  115,  118,  119,   48,   54,   55,   84,    3,    4,
+ /*   330 */    46,    6,    7,    8,    9,   10,   11,   12,   13,   14,
  /*   340 */    15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
- /*   350 */    25,   26,   27,   28,   29,   30,   38,   38,   32,   32,
- /*   360 */    32,  110,  110,   32,   46,  110,   32,   32,   50,   50,
- /*   370 */    32,   46,  120,  122,  122,    3,    4,  122,    6,    7,
+ /*   350 */    25,   26,   27,   28,   29,   30,   38,   38,    5,  110,
+ /*   360 */   110,  110,    5,  121,   46,    5,   46,   38,   50,   50,
+ /*   370 */     5,   46,  123,  123,  123,    3,    4,   48,    6,    7,
  /*   380 */     8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
  /*   390 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   400 */    28,   29,   30,   38,   32,    3,    4,   32,    6,    7,
- /*   410 */     8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
- /*   420 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   430 */    28,   29,   30,   32,   32,    3,    4,   46,    6,    7,
- /*   440 */     8,    9,   10,   11,   12,   13,   14,   15,   16,   17,
- /*   450 */    18,   19,   20,   21,   22,   23,   24,   25,   26,   27,
- /*   460 */    28,   29,   30,    3,    4,   32,    6,    7,    8,    9,
+ /*   400 */    28,   29,   30,    3,    4,   32,    6,    7,    8,    9,
+ /*   410 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*   420 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
+ /*   430 */    30,   59,   32,    3,    4,   38,    6,    7,    8,    9,
+ /*   440 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
+ /*   450 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
+ /*   460 */    30,   32,   32,    3,    4,   38,    6,    7,    8,    9,
  /*   470 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   480 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   490 */    30,   59,   32,    3,    4,   32,    6,    7,    8,    9,
+ /*   490 */    30,  113,   32,    3,    4,   38,    6,    7,    8,    9,
  /*   500 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   510 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   520 */    30,  113,   32,    3,    4,   32,    6,    7,    8,    9,
+ /*   520 */    30,   29,   32,    3,    4,   32,    6,    7,    8,    9,
  /*   530 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   540 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
  /*   550 */    30,   32,   32,    3,    4,   32,    6,    7,    8,    9,
  /*   560 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   570 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   580 */    30,   32,   32,    3,    4,    1,    6,    7,    8,    9,
+ /*   580 */    30,   32,   32,    3,    4,   38,    6,    7,    8,    9,
  /*   590 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   600 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   610 */    30,    3,    4,   57,    6,    7,    8,    9,   10,   11,
+ /*   610 */    30,    3,    4,   32,    6,    7,    8,    9,   10,   11,
  /*   620 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
  /*   630 */    22,   23,   24,   25,   26,   27,   28,   29,   30,    4,
- /*   640 */    38,    6,    7,    8,    9,   10,   11,   12,   13,   14,
+ /*   640 */     1,    6,    7,    8,    9,   10,   11,   12,   13,   14,
  /*   650 */    15,   16,   17,   18,   19,   20,   21,   22,   23,   24,
  /*   660 */    25,   26,   27,   28,   29,   30,    6,    7,    8,    9,
  /*   670 */    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,
  /*   680 */    20,   21,   22,   23,   24,   25,   26,   27,   28,   29,
- /*   690 */    30,    7,    8,    9,   10,   11,   12,   13,   14,   15,
- /*   700 */    16,   17,   18,   19,   20,   21,   22,   23,   24,   25,
- /*   710 */    26,   27,   28,   29,   30,   86,   87,   88,   89,   90,
- /*   720 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
- /*   730 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
+ /*   690 */    30,   86,   87,   88,   89,   90,   91,   92,   93,   94,
+ /*   700 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
+ /*   710 */   105,  106,  107,  108,  109,    7,    8,    9,   10,   11,
+ /*   720 */    12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
+ /*   730 */    22,   23,   24,   25,   26,   27,   28,   29,   30,   88,
  /*   740 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
  /*   750 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
  /*   760 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
@@ -466,244 +477,261 @@ static YYCODETYPE yy_lookahead[] = {
  /*  1030 */    93,   94,   95,   96,   97,   98,   99,  100,  101,  102,
  /*  1040 */   103,  104,  105,  106,  107,  108,  109,   88,   89,   90,
  /*  1050 */    91,   92,   93,   94,   95,   96,   97,   98,   99,  100,
- /*  1060 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   89,
- /*  1070 */    90,   91,   92,   93,   94,   95,   96,   97,   98,   99,
- /*  1080 */   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
- /*  1090 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
- /*  1100 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
- /*  1110 */   109,   31,   32,   33,   34,   35,   36,   37,  110,   32,
- /*  1120 */    40,    0,    1,  110,    5,  117,  110,   47,    1,    1,
- /*  1130 */   122,  123,  119,  117,  121,  122,   56,    1,  122,  123,
- /*  1140 */    60,   32,   62,  110,   64,  110,   66,   67,  110,   69,
- /*  1150 */    70,   71,  110,   73,   74,  122,  121,  122,   21,   22,
- /*  1160 */   122,   24,  110,   26,  122,    1,   29,   65,   21,   22,
- /*  1170 */   110,   24,  110,   26,  122,   38,   29,    3,   32,   58,
- /*  1180 */    32,  119,  122,  121,  122,   38,   58,   50,   51,   52,
- /*  1190 */    53,   54,   55,  110,   58,  110,   75,   50,   51,   52,
- /*  1200 */    53,   54,   55,   75,    1,  122,  123,  122,    1,  110,
- /*  1210 */     1,   75,    2,   76,   77,   78,   79,   80,   81,   82,
- /*  1220 */    83,  122,   58,   76,   77,   78,   79,   80,   81,   82,
- /*  1230 */    83,   31,   32,   33,   34,   35,   36,   37,   32,   75,
- /*  1240 */    40,  110,  110,  110,    0,  110,   38,   47,   29,   32,
- /*  1250 */     5,   38,   32,  122,  122,  122,   56,  122,   48,   32,
- /*  1260 */    60,   58,   62,    1,   64,   58,   66,   67,    1,   69,
- /*  1270 */    70,   71,    1,   73,   74,   32,  115,  110,   75,   31,
- /*  1280 */    32,   24,   75,   35,   36,   37,   32,   30,   40,  122,
- /*  1290 */     1,  120,   41,  110,  110,   47,  120,  116,   41,   42,
- /*  1300 */    43,   44,   45,    5,   56,  122,  122,   46,   60,   61,
- /*  1310 */    62,    1,   64,   32,   66,   67,    1,   69,   70,   71,
- /*  1320 */    58,   73,   74,   32,   32,   58,   32,   31,   32,   58,
- /*  1330 */     5,   35,   36,   37,   32,    1,   40,   75,    1,  110,
- /*  1340 */    32,  110,   75,   47,    5,  110,   75,   58,    1,   46,
- /*  1350 */    32,  122,   56,  122,   32,   32,   60,  122,   62,   63,
- /*  1360 */    64,  124,   66,   67,   75,   69,   70,   71,   58,   73,
- /*  1370 */    74,  124,  124,   58,  124,   31,   32,   33,  124,   35,
- /*  1380 */    36,   37,  124,    1,   40,   75,    1,  124,  124,  110,
- /*  1390 */    75,   47,   58,  124,    1,   58,    1,  124,  124,  124,
- /*  1400 */    56,  122,  124,  124,   60,   58,   62,  124,   64,   75,
- /*  1410 */    66,   67,   75,   69,   70,   71,  124,   73,   74,  124,
- /*  1420 */   124,  110,   75,   31,   32,  124,  110,   35,   36,   37,
- /*  1430 */   110,   39,   40,  122,  124,  124,  124,  124,  122,   47,
- /*  1440 */    58,  124,  122,   58,  124,  124,  124,  124,   56,  124,
- /*  1450 */   124,   58,   60,   58,   62,  124,   64,   75,   66,   67,
- /*  1460 */    75,   69,   70,   71,  124,   73,   74,  110,   75,  110,
- /*  1470 */    75,   31,   32,  110,  110,   35,   36,   37,  110,  122,
- /*  1480 */    40,  122,  124,  124,  124,  122,  122,   47,  124,  124,
- /*  1490 */   122,  110,  124,  124,  124,  124,   56,   57,  124,  124,
- /*  1500 */    60,  124,   62,  122,   64,  124,   66,   67,  124,   69,
- /*  1510 */    70,   71,  124,   73,   74,  110,  124,  110,  124,   31,
- /*  1520 */    32,  110,  110,   35,   36,   37,  110,  122,   40,  122,
- /*  1530 */   124,  124,  124,  122,  122,   47,  124,  110,  122,  124,
- /*  1540 */   124,  110,  124,  124,   56,  124,  124,  124,   60,  122,
- /*  1550 */    62,   63,   64,  122,   66,   67,  124,   69,   70,   71,
- /*  1560 */   124,   73,   74,  110,  124,  110,  124,   31,   32,  110,
- /*  1570 */   110,   35,   36,   37,  110,  122,   40,  122,  110,  110,
- /*  1580 */   124,  122,  122,   47,  124,  110,  122,  110,  124,  110,
- /*  1590 */   122,  122,   56,  124,  124,  124,   60,  122,   62,  122,
- /*  1600 */    64,  122,   66,   67,  124,   69,   70,   71,   72,   73,
- /*  1610 */    74,  110,  124,  110,  110,   31,   32,   33,  110,   35,
- /*  1620 */    36,   37,  110,  122,   40,  122,  122,  124,  124,  124,
- /*  1630 */   122,   47,  124,  110,  122,  124,  124,  124,  124,  124,
- /*  1640 */    56,  124,  124,  124,   60,  122,   62,  124,   64,  124,
- /*  1650 */    66,   67,  124,   69,   70,   71,  124,   73,   74,  124,
- /*  1660 */   124,  124,  124,   31,   32,  124,  124,   35,   36,   37,
- /*  1670 */   124,  124,   40,  124,  124,  124,  124,  124,  124,   47,
- /*  1680 */   124,   49,  124,  124,  124,  124,  124,  124,   56,  124,
- /*  1690 */   124,  124,   60,  124,   62,  124,   64,  124,   66,   67,
- /*  1700 */   124,   69,   70,   71,  124,   73,   74,  124,  124,  124,
- /*  1710 */   124,   31,   32,  124,  124,   35,   36,   37,  124,  124,
- /*  1720 */    40,  124,  124,  124,  124,  124,  124,   47,  124,  124,
- /*  1730 */   124,  124,  124,  124,  124,  124,   56,  124,  124,  124,
- /*  1740 */    60,   61,   62,  124,   64,  124,   66,   67,  124,   69,
- /*  1750 */    70,   71,  124,   73,   74,  124,  124,  124,  124,   31,
- /*  1760 */    32,  124,  124,   35,   36,   37,  124,  124,   40,  124,
- /*  1770 */   124,  124,  124,  124,  124,   47,  124,  124,  124,  124,
- /*  1780 */   124,  124,  124,  124,   56,  124,  124,  124,   60,  124,
- /*  1790 */    62,  124,   64,  124,   66,   67,  124,   69,   70,   71,
- /*  1800 */    72,   73,   74,  124,  124,  124,  124,   31,   32,  124,
- /*  1810 */   124,   35,   36,   37,  124,   39,   40,  124,  124,  124,
- /*  1820 */   124,  124,  124,   47,  124,  124,  124,  124,  124,  124,
- /*  1830 */   124,  124,   56,  124,  124,  124,   60,  124,   62,  124,
- /*  1840 */    64,  124,   66,   67,  124,   69,   70,   71,  124,   73,
- /*  1850 */    74,  124,  124,  124,  124,   31,   32,  124,  124,   35,
- /*  1860 */    36,   37,  124,  124,   40,  124,  124,  124,  124,  124,
- /*  1870 */   124,   47,  124,   49,  124,  124,  124,  124,  124,  124,
- /*  1880 */    56,  124,  124,  124,   60,  124,   62,  124,   64,  124,
- /*  1890 */    66,   67,  124,   69,   70,   71,  124,   73,   74,  124,
- /*  1900 */   124,  124,  124,   31,   32,  124,  124,   35,   36,   37,
- /*  1910 */   124,   39,   40,  124,  124,  124,  124,  124,  124,   47,
- /*  1920 */   124,  124,  124,  124,  124,  124,  124,  124,   56,  124,
- /*  1930 */   124,  124,   60,  124,   62,  124,   64,  124,   66,   67,
- /*  1940 */   124,   69,   70,   71,  124,   73,   74,  124,  124,  124,
- /*  1950 */   124,   31,   32,  124,  124,   35,   36,   37,  124,   39,
- /*  1960 */    40,  124,  124,  124,  124,  124,  124,   47,  124,  124,
- /*  1970 */   124,  124,  124,  124,  124,  124,   56,  124,  124,  124,
- /*  1980 */    60,  124,   62,  124,   64,  124,   66,   67,  124,   69,
- /*  1990 */    70,   71,  124,   73,   74,  124,  124,  124,  124,   31,
- /*  2000 */    32,  124,  124,   35,   36,   37,  124,  124,   40,  124,
- /*  2010 */   124,  124,  124,  124,  124,   47,  124,  124,  124,  124,
- /*  2020 */   124,  124,  124,  124,   56,  124,  124,  124,   60,  124,
- /*  2030 */    62,  124,   64,  124,   66,   67,  124,   69,   70,   71,
- /*  2040 */   124,   73,   74,  124,   19,  124,   21,   22,  124,   24,
- /*  2050 */     5,   26,  124,   18,   29,  124,   21,   22,  124,   24,
- /*  2060 */   124,   26,  124,   38,   29,  124,   21,   22,  124,   24,
- /*  2070 */   124,   26,  124,   38,   29,   50,   51,   52,   53,   54,
- /*  2080 */    55,  124,  124,   38,  124,   50,   51,   52,   53,   54,
- /*  2090 */    55,  124,  124,  124,  124,   50,   51,   52,   53,   54,
- /*  2100 */    55,  124,   21,   22,  124,   24,  124,   26,   83,  124,
- /*  2110 */    29,  124,   21,   22,  124,   24,  124,   26,   83,   38,
- /*  2120 */    29,  124,  124,  124,  124,  124,  124,   46,   83,   38,
- /*  2130 */   124,   50,   51,   52,   53,   54,   55,  124,  124,   48,
- /*  2140 */   124,   50,   51,   52,   53,   54,   55,  124,  124,   21,
- /*  2150 */    22,  124,   24,  124,   26,   21,   22,   29,   24,  124,
- /*  2160 */    26,  124,  124,   29,   83,  124,   38,  124,  124,  124,
- /*  2170 */   124,  124,   38,  124,   83,  124,   48,  124,   50,   51,
- /*  2180 */    52,   53,   54,   55,   50,   51,   52,   53,   54,   55,
- /*  2190 */   124,  124,  124,  124,  124,  124,   21,   22,  124,   24,
- /*  2200 */   124,   26,   21,   22,   29,   24,  124,   26,  124,  124,
- /*  2210 */    29,   83,  124,   38,  124,  124,  124,   83,   84,   38,
- /*  2220 */   124,  124,  124,  124,  124,   50,   51,   52,   53,   54,
- /*  2230 */    55,   50,   51,   52,   53,   54,   55,  124,  124,   21,
- /*  2240 */    22,  124,   24,  124,   26,  124,  124,   29,  124,  124,
- /*  2250 */   124,  124,  124,  124,  124,  124,   38,  124,   83,  124,
- /*  2260 */   124,  124,  124,  124,   83,  124,  124,  124,   50,   51,
- /*  2270 */    52,   53,   54,   55,  124,  124,  124,  124,  124,  124,
- /*  2280 */   124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
- /*  2290 */   124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
- /*  2300 */   124,   83,
+ /*  1060 */   101,  102,  103,  104,  105,  106,  107,  108,  109,   88,
+ /*  1070 */    89,   90,   91,   92,   93,   94,   95,   96,   97,   98,
+ /*  1080 */    99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+ /*  1090 */   109,   88,   89,   90,   91,   92,   93,   94,   95,   96,
+ /*  1100 */    97,   98,   99,  100,  101,  102,  103,  104,  105,  106,
+ /*  1110 */   107,  108,  109,   89,   90,   91,   92,   93,   94,   95,
+ /*  1120 */    96,   97,   98,   99,  100,  101,  102,  103,  104,  105,
+ /*  1130 */   106,  107,  108,  109,   89,   90,   91,   92,   93,   94,
+ /*  1140 */    95,   96,   97,   98,   99,  100,  101,  102,  103,  104,
+ /*  1150 */   105,  106,  107,  108,  109,   31,   32,   33,   34,   35,
+ /*  1160 */    36,   37,  110,   32,   40,    0,    1,   32,  110,  117,
+ /*  1170 */   110,   47,  110,   38,   32,  123,  124,   32,    2,  121,
+ /*  1180 */    56,  123,  122,  123,   60,  123,   62,  110,   64,   32,
+ /*  1190 */    66,   67,   32,   69,   70,   71,  110,   73,   74,   65,
+ /*  1200 */   123,  124,   21,   22,  119,   24,  120,   26,  122,  123,
+ /*  1210 */    29,   32,   21,   22,  110,   24,   32,   26,   32,   38,
+ /*  1220 */    29,   32,   46,   58,  120,  110,  122,  123,    1,   38,
+ /*  1230 */    32,   50,   51,   52,   53,   54,   55,  110,  123,   32,
+ /*  1240 */    75,   50,   51,   52,   53,   54,   55,  120,    1,  122,
+ /*  1250 */   123,    2,    1,  110,   32,    2,   32,   76,   77,   78,
+ /*  1260 */    79,   80,   81,   82,   83,   24,  123,   76,   77,   78,
+ /*  1270 */    79,   80,   81,   82,   83,   31,   32,   33,   34,   35,
+ /*  1280 */    36,   37,  110,    1,   40,   58,    1,   32,   32,  117,
+ /*  1290 */   110,   47,    1,   32,   32,  123,  124,   48,   32,   57,
+ /*  1300 */    56,   48,   75,  123,   60,   58,   62,    1,   64,   58,
+ /*  1310 */    66,   67,    1,   69,   70,   71,    1,   73,   74,   32,
+ /*  1320 */   110,   32,   75,   31,   32,   33,   75,   35,   36,   37,
+ /*  1330 */    32,    1,   40,  123,    1,   38,  110,   41,  110,   47,
+ /*  1340 */    58,  116,    1,   58,    1,  115,   32,   38,   56,  123,
+ /*  1350 */     3,  123,   60,   32,   62,  110,   64,   75,   66,   67,
+ /*  1360 */    75,   69,   70,   71,   58,   73,   74,   32,  123,   58,
+ /*  1370 */   110,   31,   32,   58,   32,   35,   36,   37,   32,   39,
+ /*  1380 */    40,   75,  110,  123,  110,  110,   75,   47,   58,   32,
+ /*  1390 */    75,   58,    1,    1,   33,  123,   56,  123,  123,   58,
+ /*  1400 */    60,   58,   62,    1,   64,   75,   66,   67,   75,   69,
+ /*  1410 */    70,   71,    1,   73,   74,   32,   75,  125,   75,   31,
+ /*  1420 */    32,   24,  125,   35,   36,   37,  125,   30,   40,  125,
+ /*  1430 */     1,  125,  125,  110,  110,   47,  125,   49,   41,   42,
+ /*  1440 */    43,   44,   45,  125,   56,  125,  123,  123,   60,   58,
+ /*  1450 */    62,    1,   64,  125,   66,   67,    1,   69,   70,   71,
+ /*  1460 */    58,   73,   74,  125,  125,  125,   75,   31,   32,   58,
+ /*  1470 */   125,   35,   36,   37,  125,    1,   40,   75,    1,  125,
+ /*  1480 */   125,  110,  110,   47,  110,  125,   75,   58,  110,  125,
+ /*  1490 */   125,  125,   56,   57,  123,  123,   60,  123,   62,  110,
+ /*  1500 */    64,  123,   66,   67,   75,   69,   70,   71,   58,   73,
+ /*  1510 */    74,  125,  123,   58,  110,   31,   32,  125,  125,   35,
+ /*  1520 */    36,   37,  125,  110,   40,   75,  125,  123,  125,  110,
+ /*  1530 */    75,   47,   58,  125,  110,   58,  123,  125,  125,  125,
+ /*  1540 */    56,  125,  123,  125,   60,   61,   62,  123,   64,   75,
+ /*  1550 */    66,   67,   75,   69,   70,   71,  125,   73,   74,  125,
+ /*  1560 */   125,  110,  110,   31,   32,  125,  125,   35,   36,   37,
+ /*  1570 */   110,  110,   40,  110,  123,  123,  125,  110,  110,   47,
+ /*  1580 */   110,  125,  125,  123,  123,  125,  123,  125,   56,  125,
+ /*  1590 */   123,  123,   60,  123,   62,   63,   64,  110,   66,   67,
+ /*  1600 */   125,   69,   70,   71,  125,   73,   74,  125,  110,  110,
+ /*  1610 */   123,   31,   32,  110,  125,   35,   36,   37,  110,  110,
+ /*  1620 */    40,  123,  123,  125,  110,  110,  123,   47,  125,  125,
+ /*  1630 */   110,  123,  123,  125,  125,  110,   56,  123,  123,  125,
+ /*  1640 */    60,  125,   62,  123,   64,  110,   66,   67,  123,   69,
+ /*  1650 */    70,   71,   72,   73,   74,  125,  110,  110,  123,   31,
+ /*  1660 */    32,  110,  125,   35,   36,   37,  110,  125,   40,  123,
+ /*  1670 */   123,  125,  110,  110,  123,   47,  125,  125,  110,  123,
+ /*  1680 */   125,  125,  125,  125,   56,  123,  123,  125,   60,  125,
+ /*  1690 */    62,  123,   64,  125,   66,   67,  125,   69,   70,   71,
+ /*  1700 */    72,   73,   74,  125,  125,  125,  125,   31,   32,  125,
+ /*  1710 */   125,   35,   36,   37,  125,  125,   40,  125,  125,  125,
+ /*  1720 */   125,  125,  125,   47,  125,  125,  125,  125,  125,  125,
+ /*  1730 */   125,  125,   56,  125,  125,  125,   60,  125,   62,   63,
+ /*  1740 */    64,  125,   66,   67,  125,   69,   70,   71,  125,   73,
+ /*  1750 */    74,  125,  125,  125,  125,   31,   32,  125,  125,   35,
+ /*  1760 */    36,   37,  125,  125,   40,  125,  125,  125,  125,  125,
+ /*  1770 */   125,   47,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  1780 */    56,  125,  125,  125,   60,  125,   62,   63,   64,  125,
+ /*  1790 */    66,   67,  125,   69,   70,   71,  125,   73,   74,  125,
+ /*  1800 */   125,  125,  125,   31,   32,  125,  125,   35,   36,   37,
+ /*  1810 */   125,  125,   40,  125,  125,  125,  125,  125,  125,   47,
+ /*  1820 */   125,  125,  125,  125,  125,  125,  125,  125,   56,  125,
+ /*  1830 */   125,  125,   60,  125,   62,   63,   64,  125,   66,   67,
+ /*  1840 */   125,   69,   70,   71,  125,   73,   74,  125,  125,  125,
+ /*  1850 */   125,   31,   32,  125,  125,   35,   36,   37,  125,  125,
+ /*  1860 */    40,  125,  125,  125,  125,  125,  125,   47,  125,  125,
+ /*  1870 */   125,  125,  125,  125,  125,  125,   56,  125,  125,  125,
+ /*  1880 */    60,   61,   62,  125,   64,  125,   66,   67,  125,   69,
+ /*  1890 */    70,   71,  125,   73,   74,  125,  125,  125,  125,   31,
+ /*  1900 */    32,  125,  125,   35,   36,   37,  125,  125,   40,  125,
+ /*  1910 */   125,  125,  125,  125,  125,   47,  125,   49,  125,  125,
+ /*  1920 */   125,  125,  125,  125,   56,  125,  125,  125,   60,  125,
+ /*  1930 */    62,  125,   64,  125,   66,   67,  125,   69,   70,   71,
+ /*  1940 */   125,   73,   74,  125,  125,  125,  125,   31,   32,  125,
+ /*  1950 */   125,   35,   36,   37,  125,   39,   40,  125,  125,  125,
+ /*  1960 */   125,  125,  125,   47,  125,  125,  125,  125,  125,  125,
+ /*  1970 */   125,  125,   56,  125,  125,  125,   60,  125,   62,  125,
+ /*  1980 */    64,  125,   66,   67,  125,   69,   70,   71,  125,   73,
+ /*  1990 */    74,  125,  125,  125,  125,   31,   32,  125,  125,   35,
+ /*  2000 */    36,   37,  125,   39,   40,  125,  125,  125,  125,  125,
+ /*  2010 */   125,   47,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  2020 */    56,  125,  125,  125,   60,  125,   62,  125,   64,  125,
+ /*  2030 */    66,   67,  125,   69,   70,   71,  125,   73,   74,  125,
+ /*  2040 */   125,  125,  125,   31,   32,  125,  125,   35,   36,   37,
+ /*  2050 */   125,   39,   40,  125,  125,  125,  125,  125,  125,   47,
+ /*  2060 */   125,  125,  125,  125,  125,  125,  125,  125,   56,  125,
+ /*  2070 */   125,  125,   60,  125,   62,  125,   64,  125,   66,   67,
+ /*  2080 */   125,   69,   70,   71,  125,   73,   74,  125,  125,  125,
+ /*  2090 */   125,   31,   32,   33,  125,   35,   36,   37,  125,  125,
+ /*  2100 */    40,  125,  125,  125,  125,  125,  125,   47,  125,  125,
+ /*  2110 */   125,  125,  125,  125,  125,  125,   56,  125,  125,  125,
+ /*  2120 */    60,  125,   62,  125,   64,  125,   66,   67,  125,   69,
+ /*  2130 */    70,   71,  125,   73,   74,  125,  125,  125,  125,   31,
+ /*  2140 */    32,  125,  125,   35,   36,   37,  125,  125,   40,  125,
+ /*  2150 */   125,  125,  125,  125,  125,   47,  125,  125,  125,  125,
+ /*  2160 */   125,  125,  125,  125,   56,  125,  125,  125,   60,  125,
+ /*  2170 */    62,  125,   64,  125,   66,   67,  125,   69,   70,   71,
+ /*  2180 */   125,   73,   74,  125,   19,  125,   21,   22,  125,   24,
+ /*  2190 */     5,   26,  125,   18,   29,  125,   21,   22,  125,   24,
+ /*  2200 */   125,   26,  125,   38,   29,  125,   21,   22,  125,   24,
+ /*  2210 */   125,   26,  125,   38,   29,   50,   51,   52,   53,   54,
+ /*  2220 */    55,  125,  125,   38,  125,   50,   51,   52,   53,   54,
+ /*  2230 */    55,  125,  125,  125,  125,   50,   51,   52,   53,   54,
+ /*  2240 */    55,  125,   21,   22,  125,   24,  125,   26,   83,  125,
+ /*  2250 */    29,  125,  125,  125,  125,  125,  125,  125,   83,   38,
+ /*  2260 */   125,  125,   21,   22,  125,   24,  125,   26,   83,   48,
+ /*  2270 */    29,   50,   51,   52,   53,   54,   55,  125,  125,   38,
+ /*  2280 */    21,   22,  125,   24,  125,   26,  125,   46,   29,  125,
+ /*  2290 */   125,   50,   51,   52,   53,   54,   55,   38,   21,   22,
+ /*  2300 */   125,   24,  125,   26,   83,  125,   29,  125,  125,   50,
+ /*  2310 */    51,   52,   53,   54,   55,   38,  125,  125,   21,   22,
+ /*  2320 */   125,   24,  125,   26,   83,   48,   29,   50,   51,   52,
+ /*  2330 */    53,   54,   55,  125,  125,   38,   21,   22,  125,   24,
+ /*  2340 */   125,   26,   83,   84,   29,  125,  125,   50,   51,   52,
+ /*  2350 */    53,   54,   55,   38,   21,   22,  125,   24,  125,   26,
+ /*  2360 */    83,  125,   29,  125,  125,   50,   51,   52,   53,   54,
+ /*  2370 */    55,   38,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  2380 */    83,  125,  125,   50,   51,   52,   53,   54,   55,  125,
+ /*  2390 */   125,  125,  125,  125,  125,  125,  125,  125,   83,  125,
+ /*  2400 */   125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+ /*  2410 */   125,  125,  125,  125,  125,  125,   83,
 };
 #define YY_SHIFT_USE_DFLT (-4)
 static short yy_shift_ofst[] = {
- /*     0 */  1128, 1244, 1121,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
+ /*     0 */  1227,   28, 1165,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
  /*    10 */    -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
- /*    20 */    -4,   -4,   -4,   -4, 1968, 2175,  402, 1136, 1164, 1200,
- /*    30 */  1227,   -4, 1243, 1203, 1262, 1344,   81,   -4, 2175,  372,
- /*    40 */    -4, 2175, 2175,  285, 2175, 2175,  285, 2025,   15, 2035,
- /*    50 */    15, 2175,   15, 2175,  774, 2175,  774, 2175,  285, 2175,
- /*    60 */     4, 2175,  684, 2175,  212, 1137,  212, 1147,  212, 2175,
- /*    70 */   212, 2175,  212, 2175,  212, 2175,  212, 2175,  212, 2175,
- /*    80 */   212, 2175,   -4, 2175,  635,   25, 2175,    4,   -4,   -4,
- /*    90 */  2045,  278,   -4, 2175,  171, 2175,  660, 2091,  608, 2175,
- /*   100 */     4, 2175,  199,   -4, 2081,  608,   -4,    0,   -4, 2181,
- /*   110 */  2134,   -4,  246,   -4,   -4, 1298, 2175,  608,   -4,   -4,
- /*   120 */    -4,   -4,   -4,   -4,   -4,   -4,   -4, 1210,   -4, 2218,
- /*   130 */    -4, 1325, 2175,  608,   -4,   -4,  319, 1261,   -4, 1303,
- /*   140 */   391, 1339,  318,   -4,  237,   -4, 1119, 1245,   -4,   -4,
+ /*    20 */    -4,   -4,   -4,   -4, 2108, 2297,  141, 1247, 1251, 1124,
+ /*    30 */    77,   -4,   81, 1282, 1285, 1292,  111,   -4, 2297,  171,
+ /*    40 */    -4, 2297, 2297,  283, 2297, 2297,  283, 2165,   15, 2175,
+ /*    50 */    15, 2297,   15, 2297,  774, 2297,  774, 2297,  283, 2297,
+ /*    60 */     4, 2297,  708, 2297,  214, 1181,  214, 1191,  214, 2297,
+ /*    70 */   214, 2297,  214, 2297,  214, 2297,  214, 2297,  214, 2297,
+ /*    80 */   214, 2297,   -4, 2297,  635,  169, 2297,    4,   -4,   -4,
+ /*    90 */  2185,  201,   -4, 2297,  248, 2297,  660, 2221,  580, 2297,
+ /*   100 */     4, 2297,  276,   -4, 2241,  580,   -4,    0,   -4, 2315,
+ /*   110 */  2259,   -4,  243,   -4,   -4,  241, 2297,  580,   -4,   -4,
+ /*   120 */    -4,   -4,   -4,   -4,   -4,   -4,   -4,  200,   -4, 2333,
+ /*   130 */    -4,  353, 2297,  580,   -4,   -4,  319,  160,   -4,  235,
+ /*   140 */   284,  357,  318,   -4,  320,   -4,  360,  365,   -4,   -4,
  /*   150 */    -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
- /*   160 */    -4,   -4, 2175,   15, 2175,   15,  285,  285,  493,   -4,
- /*   170 */   365,  109, 2175,   78, 1128, 1207, 1872, 1281,   -4,  208,
- /*   180 */    51,   -4,  208,   -4, 1257, 2175,  608, 2175,  608, 2175,
- /*   190 */   608, 2175,  608, 2175,  608, 2175,  325,   -4,  208,   -4,
- /*   200 */    -4,   -4, 1208, 1219,  205, 1254, 1128, 1267, 1632, 1302,
- /*   210 */    -4, 2175,  580, 2128,  277,  334, 1128, 1271, 1440, 1292,
- /*   220 */    -4,   -4,   41,  326, 1289, 1310, 1248,  114,   -4, 2175,
- /*   230 */    -3, 1128, 1315, 1296,  331,   -4,  401, 1128, 2175,  432,
- /*   240 */    -4, 1127, 1102, 1206,   -4,   -4, 2175,  490,   -4, 2175,
- /*   250 */    48,   -4, 2175,  520,   -4, 2175,  550,   -4, 2175,  141,
- /*   260 */    -4,  272, 1109, 1128, 1334, 1728, 1308,   -4, 1323,   -4,
- /*   270 */   327,   -4,   -4, 1294, 1128, 1337, 1536, 1322,   -4,  523,
- /*   280 */  1128, 1347, 1488,  328,   -4,  338,  375, 1680,  463,   -4,
- /*   290 */   519,  584,  556, 1087,   -4,  202, 1146, 1128, 1382, 1824,
- /*   300 */  1217,   -4, 1213,   -4, 1251,  266,   -4,   -4,   -4,   -4,
- /*   310 */    -4,   -4,   -4,   -4, 2175,  248, 1128, 1385, 1920,  433,
- /*   320 */    -4,  602, 1174, 2175,  111, 1128, 1393, 1776, 1318,   -4,
- /*   330 */  2175,  460, 1128, 1395, 1392, 1148,   -4, 1584,  549,   -4,
- /*   340 */  1080, 1220,   -4,  335, 1209,  216, 1291,   -4,
+ /*   160 */    -4,   -4, 2297,   15, 2297,   15,  283,  283,  373,   -4,
+ /*   170 */   397,  139, 2297,   48, 1227, 1306, 1340,  429,   -4,  427,
+ /*   180 */    51,   -4,  427,   -4, 1397, 2297,  580, 2297,  580, 2297,
+ /*   190 */   580, 2297,  580, 2297,  580, 2297,  325,   -4,  427,   -4,
+ /*   200 */    -4,   -4,  457,  492,  329,  493, 1227, 1311, 1388,  519,
+ /*   210 */    -4, 2297,  608, 2277, 1249,  523, 1227, 1315, 1436,  549,
+ /*   220 */    -4,   -4,  547,  581, 1330, 1333, 1484, 1131,   -4, 2297,
+ /*   230 */    -3, 1227, 1341, 1532, 1142,   -4, 1145, 1227, 2297,  372,
+ /*   240 */    -4,  639, 1134, 1157,   -4,   -4, 2297,  400,   -4, 2297,
+ /*   250 */    78,   -4, 2297,  430,   -4, 2297,  460,   -4, 2297,  490,
+ /*   260 */    -4,  271, 1160, 1227, 1343, 1580, 1179,   -4, 1184,   -4,
+ /*   270 */  1186,   -4,   -4, 1189, 1227, 1391, 1628, 1198,   -4, 1135,
+ /*   280 */  1227, 1402, 1676, 1207,   -4, 1222, 1227, 1411, 1724, 1224,
+ /*   290 */    -4, 1241, 2315, 1176, 1255, 1256, 1227, 1429, 1772, 1261,
+ /*   300 */    -4,   -4, 1241, 1820, 1262,   -4, 1266, 1291, 1242, 1287,
+ /*   310 */    -4, 1253, 1289, 1227, 1450, 1868, 1298,   -4, 1297,   -4,
+ /*   320 */  1296,  264,   -4,   -4,   -4,   -4,   -4,   -4,   -4,   -4,
+ /*   330 */  2297,  520, 1227, 1455, 1916, 1314,   -4, 1309, 1347, 2297,
+ /*   340 */   108, 1227, 1474, 1964, 1321,   -4, 2297,  550, 1227, 1477,
+ /*   350 */  2012, 1335,   -4, 2060, 1342,   -4, 1244, 1346,   -4, 1357,
+ /*   360 */  1392, 1361, 1383,   -4,
 };
 #define YY_REDUCE_USE_DFLT (-64)
 static short yy_reduce_ofst[] = {
- /*     0 */   629,  -64,  980,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*     0 */   605,  -64, 1024,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
  /*    10 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
- /*    20 */   -64,  -64,  -64,  -64,  -64, 1033,  -64,  651,  980,  -64,
- /*    30 */   -64,  -64,  -64,  937,  980,  -64,  -64,  -64, 1184,  -64,
- /*    40 */   -64, 1038, 1523,  -64, 1464, 1459,  -64, 1453,  -64, 1411,
- /*    50 */   -64, 1381,  -64, 1135,  -64,  251,  -64, 1131,  -64, 1427,
- /*    60 */   -64, 1363,  -64, 1279,  -64, 1359,  -64, 1099,  -64, 1052,
- /*    70 */   -64, 1183,  -64, 1479,  -64, 1357,  -64, 1512,  -64, 1503,
- /*    80 */   -64, 1501,  -64, 1469,  -64,  -64, 1431,  -64,  -64,  -64,
- /*    90 */   252,  -64,  -64, 1468,  -64, 1475,  -64, 1008,  -64, 1508,
- /*   100 */   -64,  255,  -64,  -64, 1013,  -64,  -64,  -64,  -64, 1035,
- /*   110 */  1062,  -64,  -64,  -64,  -64,  -64, 1060,  -64,  -64,  -64,
- /*   120 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64, 1083,
- /*   130 */   -64,  -64, 1407,  -64,  -64,  -64, 1171,  -64,  -64,  -64,
- /*   140 */   -64,  -64, 1176,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*    20 */   -64,  -64,  -64,  -64,  -64, 1062,  -64,  651, 1024,  -64,
+ /*    30 */   -64,  -64,  -64,  673, 1024,  -64,  -64,  -64, 1115,  -64,
+ /*    40 */   -64, 1143, 1180,  -64, 1210, 1226,  -64, 1228,  -64, 1245,
+ /*    50 */   -64, 1260,  -64, 1272,  -64, 1274,  -64, 1275,  -64, 1323,
+ /*    60 */   -64, 1324,  -64, 1371,  -64, 1372,  -64, 1374,  -64, 1378,
+ /*    70 */   -64, 1389,  -64, 1404,  -64, 1413,  -64, 1419,  -64, 1424,
+ /*    80 */   -64, 1451,  -64, 1452,  -64,  -64, 1460,  -64,  -64,  -64,
+ /*    90 */  1058,  -64,  -64, 1461,  -64, 1463,  -64, 1052,  -64, 1467,
+ /*   100 */   -64, 1468,  -64,  -64, 1086,  -64,  -64,  -64,  -64, 1060,
+ /*   110 */  1104,  -64,  -64,  -64,  -64,  -64, 1470,  -64,  -64,  -64,
+ /*   120 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64, 1077,
+ /*   130 */   -64,  -64,  249,  -64,  -64,  -64,   55,  -64,  -64,  -64,
+ /*   140 */   -64,  -64,  242,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
  /*   150 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
- /*   160 */   -64,  -64, 1311,  -64, 1368,  -64,  -64,  -64,  -64,  -64,
- /*   170 */   -64,  -64, 1132,  -64,  849,  980,  -64,  -64,  -64,  -63,
- /*   180 */   -64,  -64,  210,  -64,  -64, 1405,  -64, 1416,  -64, 1455,
- /*   190 */   -64, 1460,  -64, 1504,  -64, 1042,  -64,  -64,  408,  -64,
- /*   200 */   -64,  -64,  -64,  -64,  130,  -64,  673,  980,  -64,  -64,
- /*   210 */   -64, 1231,  -64, 1016,  -64,  -64,  761,  980,  -64,  -64,
- /*   220 */   -64,  -64,  -64,  -64,  959,  980,  -64,  -64,  -64, 1477,
- /*   230 */    54,  717,  980,  -64,  -64,  -64,  -64, 1001, 1085,  -64,
- /*   240 */   -64,  -64,  -64,  -64,  -64,  -64, 1133,  -64,  -64, 1167,
- /*   250 */   -64,  -64, 1229,  -64,  -64, 1235,  -64,  -64, 1320,  -64,
- /*   260 */   -64,  -64,  -64,  739,  980,  -64,  -64,  -64,  -64,  -64,
- /*   270 */   -64,  -64,  -64,  -64,  805,  980,  -64,  -64,  -64,  -64,
- /*   280 */   783,  980,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
- /*   290 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  871,  980,  -64,
- /*   300 */   -64,  -64, 1161,  -64,  -64, 1181,  -64,  -64,  -64,  -64,
- /*   310 */   -64,  -64,  -64,  -64, 1316,  -64,  893,  980,  -64,  -64,
- /*   320 */   -64,  -64,  -64, 1364,  -64,  915,  980,  -64,  -64,  -64,
- /*   330 */  1412,  -64,  827,  980,  -64,  -64,  -64,  -64,  -64,  -64,
- /*   340 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*   160 */   -64,  -64, 1487,  -64, 1498,  -64,  -64,  -64,  -64,  -64,
+ /*   170 */   -64,  -64, 1499,  -64,  717, 1024,  -64,  -64,  -64,  -63,
+ /*   180 */   -64,  -64,  137,  -64,  -64,  250,  -64,  251,  -64, 1503,
+ /*   190 */   -64, 1508,  -64, 1509,  -64, 1514,  -64,  -64,  378,  -64,
+ /*   200 */   -64,  -64,  -64,  -64,  206,  -64,  739, 1024,  -64,  -64,
+ /*   210 */   -64, 1515,  -64, 1172,  -64,  -64,  761, 1024,  -64,  -64,
+ /*   220 */   -64,  -64,  -64,  -64,  783, 1024,  -64,  -64,  -64, 1520,
+ /*   230 */   204,  805, 1024,  -64,  -64,  -64,  -64, 1045, 1525,  -64,
+ /*   240 */   -64,  -64,  -64,  -64,  -64,  -64, 1535,  -64,  -64, 1546,
+ /*   250 */   -64,  -64, 1547,  -64,  -64, 1551,  -64,  -64, 1556,  -64,
+ /*   260 */   -64,  -64,  -64,  827, 1024,  -64,  -64,  -64,  -64,  -64,
+ /*   270 */   -64,  -64,  -64,  -64,  849, 1024,  -64,  -64,  -64, 1085,
+ /*   280 */   871, 1024,  -64,  -64,  -64,  -64,  893, 1024,  -64,  -64,
+ /*   290 */   -64,  -64, 1127,  -64,  -64,  -64,  915, 1024,  -64,  -64,
+ /*   300 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*   310 */   -64,  -64,  -64,  937, 1024,  -64,  -64,  -64, 1230,  -64,
+ /*   320 */   -64, 1225,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*   330 */  1562,  -64,  959, 1024,  -64,  -64,  -64,  -64,  -64, 1563,
+ /*   340 */   -64,  981, 1024,  -64,  -64,  -64, 1568,  -64, 1003, 1024,
+ /*   350 */   -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,  -64,
+ /*   360 */   -64,  -64,  -64,  -64,
 };
 static YYACTIONTYPE yy_default[] = {
- /*     0 */   500,  500,  500,  350,  352,  353,  354,  355,  356,  357,
- /*    10 */   358,  359,  360,  361,  362,  363,  364,  365,  366,  367,
- /*    20 */   368,  369,  370,  371,  500,  500,  500,  500,  500,  500,
- /*    30 */   500,  372,  500,  500,  500,  500,  500,  374,  500,  500,
- /*    40 */   377,  500,  500,  427,  500,  500,  428,  500,  431,  500,
- /*    50 */   433,  500,  435,  500,  436,  500,  437,  500,  438,  500,
- /*    60 */   439,  500,  440,  500,  441,  500,  457,  500,  456,  500,
- /*    70 */   458,  500,  459,  500,  460,  500,  461,  500,  462,  500,
- /*    80 */   463,  500,  464,  500,  465,  500,  500,  466,  468,  469,
- /*    90 */   500,  500,  475,  500,  500,  500,  476,  500,  491,  500,
- /*   100 */   467,  500,  500,  470,  500,  485,  471,  500,  472,  500,
- /*   110 */   500,  473,  500,  474,  483,  495,  500,  484,  486,  493,
- /*   120 */   494,  495,  496,  497,  498,  499,  482,  500,  487,  500,
- /*   130 */   489,  495,  500,  492,  488,  490,  500,  500,  477,  500,
- /*   140 */   500,  500,  500,  478,  500,  479,  494,  493,  443,  445,
- /*   150 */   447,  449,  451,  453,  455,  442,  444,  446,  448,  450,
- /*   160 */   452,  454,  500,  434,  500,  432,  430,  429,  500,  378,
- /*   170 */   500,  500,  500,  500,  500,  500,  500,  500,  379,  500,
- /*   180 */   500,  383,  500,  384,  500,  500,  386,  500,  387,  500,
- /*   190 */   388,  500,  389,  500,  390,  500,  500,  392,  500,  391,
- /*   200 */   393,  385,  500,  500,  500,  500,  500,  500,  500,  500,
- /*   210 */   394,  500,  500,  500,  500,  487,  500,  500,  500,  500,
- /*   220 */   406,  408,  500,  500,  500,  500,  500,  500,  410,  500,
- /*   230 */   500,  500,  500,  500,  500,  412,  500,  500,  500,  500,
- /*   240 */   409,  500,  500,  500,  416,  426,  500,  500,  417,  500,
- /*   250 */   500,  418,  500,  500,  419,  500,  500,  420,  500,  500,
- /*   260 */   421,  500,  500,  500,  500,  500,  500,  422,  500,  424,
- /*   270 */   500,  425,  351,  500,  500,  500,  500,  500,  423,  500,
- /*   280 */   500,  500,  500,  500,  413,  500,  500,  500,  500,  411,
- /*   290 */   488,  500,  500,  500,  407,  500,  500,  500,  500,  500,
- /*   300 */   500,  395,  500,  396,  398,  500,  399,  400,  401,  402,
- /*   310 */   403,  404,  405,  397,  500,  500,  500,  500,  500,  500,
- /*   320 */   380,  500,  500,  500,  500,  500,  500,  500,  500,  381,
- /*   330 */   500,  500,  500,  500,  500,  500,  382,  500,  500,  375,
- /*   340 */   500,  500,  373,  500,  500,  500,  500,  376,
+ /*     0 */   519,  519,  519,  366,  368,  369,  370,  371,  372,  373,
+ /*    10 */   374,  375,  376,  377,  378,  379,  380,  381,  382,  383,
+ /*    20 */   384,  385,  386,  387,  519,  519,  519,  519,  519,  519,
+ /*    30 */   519,  388,  519,  519,  519,  519,  519,  390,  519,  519,
+ /*    40 */   393,  519,  519,  446,  519,  519,  447,  519,  450,  519,
+ /*    50 */   452,  519,  454,  519,  455,  519,  456,  519,  457,  519,
+ /*    60 */   458,  519,  459,  519,  460,  519,  476,  519,  475,  519,
+ /*    70 */   477,  519,  478,  519,  479,  519,  480,  519,  481,  519,
+ /*    80 */   482,  519,  483,  519,  484,  519,  519,  485,  487,  488,
+ /*    90 */   519,  519,  494,  519,  519,  519,  495,  519,  510,  519,
+ /*   100 */   486,  519,  519,  489,  519,  504,  490,  519,  491,  519,
+ /*   110 */   519,  492,  519,  493,  502,  514,  519,  503,  505,  512,
+ /*   120 */   513,  514,  515,  516,  517,  518,  501,  519,  506,  519,
+ /*   130 */   508,  514,  519,  511,  507,  509,  519,  519,  496,  519,
+ /*   140 */   519,  519,  519,  497,  519,  498,  513,  512,  462,  464,
+ /*   150 */   466,  468,  470,  472,  474,  461,  463,  465,  467,  469,
+ /*   160 */   471,  473,  519,  453,  519,  451,  449,  448,  519,  394,
+ /*   170 */   519,  519,  519,  519,  519,  519,  519,  519,  395,  519,
+ /*   180 */   519,  399,  519,  400,  519,  519,  402,  519,  403,  519,
+ /*   190 */   404,  519,  405,  519,  406,  519,  519,  408,  519,  407,
+ /*   200 */   409,  401,  519,  519,  519,  519,  519,  519,  519,  519,
+ /*   210 */   410,  519,  519,  519,  519,  506,  519,  519,  519,  519,
+ /*   220 */   422,  424,  519,  519,  519,  519,  519,  519,  426,  519,
+ /*   230 */   519,  519,  519,  519,  519,  428,  519,  519,  519,  519,
+ /*   240 */   425,  519,  519,  519,  435,  445,  519,  519,  436,  519,
+ /*   250 */   519,  437,  519,  519,  438,  519,  519,  439,  519,  519,
+ /*   260 */   440,  519,  519,  519,  519,  519,  519,  441,  519,  443,
+ /*   270 */   519,  444,  367,  519,  519,  519,  519,  519,  442,  519,
+ /*   280 */   519,  519,  519,  519,  429,  519,  519,  519,  519,  519,
+ /*   290 */   431,  519,  519,  519,  519,  519,  519,  519,  519,  519,
+ /*   300 */   430,  432,  433,  519,  519,  427,  507,  519,  519,  519,
+ /*   310 */   423,  519,  519,  519,  519,  519,  519,  411,  519,  412,
+ /*   320 */   414,  519,  415,  416,  417,  418,  419,  420,  421,  413,
+ /*   330 */   519,  519,  519,  519,  519,  519,  396,  519,  519,  519,
+ /*   340 */   519,  519,  519,  519,  519,  397,  519,  519,  519,  519,
+ /*   350 */   519,  519,  398,  519,  519,  391,  519,  519,  389,  519,
+ /*   360 */   519,  519,  519,  392,
 };
 #define YY_SZ_ACTTAB (sizeof(yy_action)/sizeof(yy_action[0]))
 
@@ -818,8 +846,9 @@ static const char *yyTokenName[] = {
   "raw_statement",  "break_statement",  "continue_statement",  "macro_statement",
   "empty_statement",  "macro_call_statement",  "expr",          "set_assignments",
   "set_assignment",  "assignable_expr",  "macro_parameters",  "macro_parameter",
-  "macro_parameter_default",  "argument_list",  "cache_lifetime",  "array_list",  
-  "slice_offset",  "array_item",    "function_call",  "argument_item",
+  "macro_parameter_default",  "argument_list",  "cache_lifetime",  "cache_tags",  
+  "array_list",    "slice_offset",  "array_item",    "function_call",
+  "argument_item",
 };
 #endif /* NDEBUG */
 
@@ -893,92 +922,95 @@ static const char *yyRuleName[] = {
  /*  63 */ "block_statement ::= OPEN_DELIMITER BLOCK IDENTIFIER CLOSE_DELIMITER OPEN_DELIMITER ENDBLOCK CLOSE_DELIMITER",
  /*  64 */ "cache_statement ::= OPEN_DELIMITER CACHE expr CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
  /*  65 */ "cache_statement ::= OPEN_DELIMITER CACHE expr cache_lifetime CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
- /*  66 */ "cache_lifetime ::= INTEGER",
- /*  67 */ "cache_lifetime ::= IDENTIFIER",
- /*  68 */ "raw_statement ::= OPEN_DELIMITER RAW CLOSE_DELIMITER statement OPEN_DELIMITER ENDRAW CLOSE_DELIMITER",
- /*  69 */ "extends_statement ::= OPEN_DELIMITER EXTENDS expr CLOSE_DELIMITER",
- /*  70 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr CLOSE_DELIMITER",
- /*  71 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr WITH expr CLOSE_DELIMITER",
- /*  72 */ "do_statement ::= OPEN_DELIMITER DO expr CLOSE_DELIMITER",
- /*  73 */ "return_statement ::= OPEN_DELIMITER RETURN expr CLOSE_DELIMITER",
- /*  74 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE FALSE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
- /*  75 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE TRUE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
- /*  76 */ "break_statement ::= OPEN_DELIMITER BREAK CLOSE_DELIMITER",
- /*  77 */ "continue_statement ::= OPEN_DELIMITER CONTINUE CLOSE_DELIMITER",
- /*  78 */ "raw_fragment ::= RAW_FRAGMENT",
- /*  79 */ "expr ::= MINUS expr",
- /*  80 */ "expr ::= PLUS expr",
- /*  81 */ "expr ::= expr MINUS expr",
- /*  82 */ "expr ::= expr PLUS expr",
- /*  83 */ "expr ::= expr TIMES expr",
- /*  84 */ "expr ::= expr TIMES TIMES expr",
- /*  85 */ "expr ::= expr DIVIDE expr",
- /*  86 */ "expr ::= expr DIVIDE DIVIDE expr",
- /*  87 */ "expr ::= expr MOD expr",
- /*  88 */ "expr ::= expr AND expr",
- /*  89 */ "expr ::= expr OR expr",
- /*  90 */ "expr ::= expr CONCAT expr",
- /*  91 */ "expr ::= expr PIPE expr",
- /*  92 */ "expr ::= expr RANGE expr",
- /*  93 */ "expr ::= expr EQUALS expr",
- /*  94 */ "expr ::= expr NOTEQUALS DEFINED",
- /*  95 */ "expr ::= expr IS DEFINED",
- /*  96 */ "expr ::= expr NOTEQUALS EMPTY",
- /*  97 */ "expr ::= expr IS EMPTY",
- /*  98 */ "expr ::= expr NOTEQUALS EVEN",
- /*  99 */ "expr ::= expr IS EVEN",
- /* 100 */ "expr ::= expr NOTEQUALS ODD",
- /* 101 */ "expr ::= expr IS ODD",
- /* 102 */ "expr ::= expr NOTEQUALS NUMERIC",
- /* 103 */ "expr ::= expr IS NUMERIC",
- /* 104 */ "expr ::= expr NOTEQUALS SCALAR",
- /* 105 */ "expr ::= expr IS SCALAR",
- /* 106 */ "expr ::= expr NOTEQUALS ITERABLE",
- /* 107 */ "expr ::= expr IS ITERABLE",
- /* 108 */ "expr ::= expr IS expr",
- /* 109 */ "expr ::= expr NOTEQUALS expr",
- /* 110 */ "expr ::= expr IDENTICAL expr",
- /* 111 */ "expr ::= expr NOTIDENTICAL expr",
- /* 112 */ "expr ::= expr LESS expr",
- /* 113 */ "expr ::= expr GREATER expr",
- /* 114 */ "expr ::= expr GREATEREQUAL expr",
- /* 115 */ "expr ::= expr LESSEQUAL expr",
- /* 116 */ "expr ::= expr DOT expr",
- /* 117 */ "expr ::= expr IN expr",
- /* 118 */ "expr ::= expr NOT IN expr",
- /* 119 */ "expr ::= NOT expr",
- /* 120 */ "expr ::= expr INCR",
- /* 121 */ "expr ::= expr DECR",
- /* 122 */ "expr ::= PARENTHESES_OPEN expr PARENTHESES_CLOSE",
- /* 123 */ "expr ::= SBRACKET_OPEN SBRACKET_CLOSE",
- /* 124 */ "expr ::= SBRACKET_OPEN array_list SBRACKET_CLOSE",
- /* 125 */ "expr ::= CBRACKET_OPEN CBRACKET_CLOSE",
- /* 126 */ "expr ::= CBRACKET_OPEN array_list CBRACKET_CLOSE",
- /* 127 */ "expr ::= expr SBRACKET_OPEN expr SBRACKET_CLOSE",
- /* 128 */ "expr ::= expr QUESTION expr COLON expr",
- /* 129 */ "expr ::= expr SBRACKET_OPEN COLON slice_offset SBRACKET_CLOSE",
- /* 130 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON SBRACKET_CLOSE",
- /* 131 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON slice_offset SBRACKET_CLOSE",
- /* 132 */ "slice_offset ::= INTEGER",
- /* 133 */ "slice_offset ::= IDENTIFIER",
- /* 134 */ "array_list ::= array_list COMMA array_item",
- /* 135 */ "array_list ::= array_item",
- /* 136 */ "array_item ::= STRING COLON expr",
- /* 137 */ "array_item ::= expr",
- /* 138 */ "expr ::= function_call",
- /* 139 */ "function_call ::= expr PARENTHESES_OPEN argument_list PARENTHESES_CLOSE",
- /* 140 */ "function_call ::= expr PARENTHESES_OPEN PARENTHESES_CLOSE",
- /* 141 */ "argument_list ::= argument_list COMMA argument_item",
- /* 142 */ "argument_list ::= argument_item",
- /* 143 */ "argument_item ::= expr",
- /* 144 */ "argument_item ::= STRING COLON expr",
- /* 145 */ "expr ::= IDENTIFIER",
- /* 146 */ "expr ::= INTEGER",
- /* 147 */ "expr ::= STRING",
- /* 148 */ "expr ::= DOUBLE",
- /* 149 */ "expr ::= NULL",
- /* 150 */ "expr ::= FALSE",
- /* 151 */ "expr ::= TRUE",
+ /*  66 */ "cache_statement ::= OPEN_DELIMITER CACHE expr cache_tags CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
+ /*  67 */ "cache_statement ::= OPEN_DELIMITER CACHE expr cache_lifetime cache_tags CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDCACHE CLOSE_DELIMITER",
+ /*  68 */ "cache_lifetime ::= INTEGER",
+ /*  69 */ "cache_lifetime ::= IDENTIFIER",
+ /*  70 */ "cache_tags ::= IDENTIFIER SBRACKET_OPEN array_list SBRACKET_CLOSE",
+ /*  71 */ "raw_statement ::= OPEN_DELIMITER RAW CLOSE_DELIMITER statement OPEN_DELIMITER ENDRAW CLOSE_DELIMITER",
+ /*  72 */ "extends_statement ::= OPEN_DELIMITER EXTENDS expr CLOSE_DELIMITER",
+ /*  73 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr CLOSE_DELIMITER",
+ /*  74 */ "include_statement ::= OPEN_DELIMITER INCLUDE expr WITH expr CLOSE_DELIMITER",
+ /*  75 */ "do_statement ::= OPEN_DELIMITER DO expr CLOSE_DELIMITER",
+ /*  76 */ "return_statement ::= OPEN_DELIMITER RETURN expr CLOSE_DELIMITER",
+ /*  77 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE FALSE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
+ /*  78 */ "autoescape_statement ::= OPEN_DELIMITER AUTOESCAPE TRUE CLOSE_DELIMITER statement_list OPEN_DELIMITER ENDAUTOESCAPE CLOSE_DELIMITER",
+ /*  79 */ "break_statement ::= OPEN_DELIMITER BREAK CLOSE_DELIMITER",
+ /*  80 */ "continue_statement ::= OPEN_DELIMITER CONTINUE CLOSE_DELIMITER",
+ /*  81 */ "raw_fragment ::= RAW_FRAGMENT",
+ /*  82 */ "expr ::= MINUS expr",
+ /*  83 */ "expr ::= PLUS expr",
+ /*  84 */ "expr ::= expr MINUS expr",
+ /*  85 */ "expr ::= expr PLUS expr",
+ /*  86 */ "expr ::= expr TIMES expr",
+ /*  87 */ "expr ::= expr TIMES TIMES expr",
+ /*  88 */ "expr ::= expr DIVIDE expr",
+ /*  89 */ "expr ::= expr DIVIDE DIVIDE expr",
+ /*  90 */ "expr ::= expr MOD expr",
+ /*  91 */ "expr ::= expr AND expr",
+ /*  92 */ "expr ::= expr OR expr",
+ /*  93 */ "expr ::= expr CONCAT expr",
+ /*  94 */ "expr ::= expr PIPE expr",
+ /*  95 */ "expr ::= expr RANGE expr",
+ /*  96 */ "expr ::= expr EQUALS expr",
+ /*  97 */ "expr ::= expr NOTEQUALS DEFINED",
+ /*  98 */ "expr ::= expr IS DEFINED",
+ /*  99 */ "expr ::= expr NOTEQUALS EMPTY",
+ /* 100 */ "expr ::= expr IS EMPTY",
+ /* 101 */ "expr ::= expr NOTEQUALS EVEN",
+ /* 102 */ "expr ::= expr IS EVEN",
+ /* 103 */ "expr ::= expr NOTEQUALS ODD",
+ /* 104 */ "expr ::= expr IS ODD",
+ /* 105 */ "expr ::= expr NOTEQUALS NUMERIC",
+ /* 106 */ "expr ::= expr IS NUMERIC",
+ /* 107 */ "expr ::= expr NOTEQUALS SCALAR",
+ /* 108 */ "expr ::= expr IS SCALAR",
+ /* 109 */ "expr ::= expr NOTEQUALS ITERABLE",
+ /* 110 */ "expr ::= expr IS ITERABLE",
+ /* 111 */ "expr ::= expr IS expr",
+ /* 112 */ "expr ::= expr NOTEQUALS expr",
+ /* 113 */ "expr ::= expr IDENTICAL expr",
+ /* 114 */ "expr ::= expr NOTIDENTICAL expr",
+ /* 115 */ "expr ::= expr LESS expr",
+ /* 116 */ "expr ::= expr GREATER expr",
+ /* 117 */ "expr ::= expr GREATEREQUAL expr",
+ /* 118 */ "expr ::= expr LESSEQUAL expr",
+ /* 119 */ "expr ::= expr DOT expr",
+ /* 120 */ "expr ::= expr IN expr",
+ /* 121 */ "expr ::= expr NOT IN expr",
+ /* 122 */ "expr ::= NOT expr",
+ /* 123 */ "expr ::= expr INCR",
+ /* 124 */ "expr ::= expr DECR",
+ /* 125 */ "expr ::= PARENTHESES_OPEN expr PARENTHESES_CLOSE",
+ /* 126 */ "expr ::= SBRACKET_OPEN SBRACKET_CLOSE",
+ /* 127 */ "expr ::= SBRACKET_OPEN array_list SBRACKET_CLOSE",
+ /* 128 */ "expr ::= CBRACKET_OPEN CBRACKET_CLOSE",
+ /* 129 */ "expr ::= CBRACKET_OPEN array_list CBRACKET_CLOSE",
+ /* 130 */ "expr ::= expr SBRACKET_OPEN expr SBRACKET_CLOSE",
+ /* 131 */ "expr ::= expr QUESTION expr COLON expr",
+ /* 132 */ "expr ::= expr SBRACKET_OPEN COLON slice_offset SBRACKET_CLOSE",
+ /* 133 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON SBRACKET_CLOSE",
+ /* 134 */ "expr ::= expr SBRACKET_OPEN slice_offset COLON slice_offset SBRACKET_CLOSE",
+ /* 135 */ "slice_offset ::= INTEGER",
+ /* 136 */ "slice_offset ::= IDENTIFIER",
+ /* 137 */ "array_list ::= array_list COMMA array_item",
+ /* 138 */ "array_list ::= array_item",
+ /* 139 */ "array_item ::= STRING COLON expr",
+ /* 140 */ "array_item ::= expr",
+ /* 141 */ "expr ::= function_call",
+ /* 142 */ "function_call ::= expr PARENTHESES_OPEN argument_list PARENTHESES_CLOSE",
+ /* 143 */ "function_call ::= expr PARENTHESES_OPEN PARENTHESES_CLOSE",
+ /* 144 */ "argument_list ::= argument_list COMMA argument_item",
+ /* 145 */ "argument_list ::= argument_item",
+ /* 146 */ "argument_item ::= expr",
+ /* 147 */ "argument_item ::= STRING COLON expr",
+ /* 148 */ "expr ::= IDENTIFIER",
+ /* 149 */ "expr ::= INTEGER",
+ /* 150 */ "expr ::= STRING",
+ /* 151 */ "expr ::= DOUBLE",
+ /* 152 */ "expr ::= NULL",
+ /* 153 */ "expr ::= FALSE",
+ /* 154 */ "expr ::= TRUE",
 };
 #endif /* NDEBUG */
 
@@ -1129,7 +1161,7 @@ static void yy_destructor(YYCODETYPE yymajor, YYMINORTYPE *yypminor){
 		efree((yypminor->yy0));
 	}
 }
-#line 1133 "parser.php5.c"
+#line 1165 "parser.php5.c"
       break;
     case 88:
     case 89:
@@ -1165,13 +1197,14 @@ static void yy_destructor(YYCODETYPE yymajor, YYMINORTYPE *yypminor){
     case 121:
     case 122:
     case 123:
+    case 124:
 #line 172 "parser.php5.lemon"
 {
 #if PHP_VERSION_ID < 70000
-	zval_ptr_dtor(&(yypminor->yy40));
+	zval_ptr_dtor(&(yypminor->yy158));
 #endif
 }
-#line 1175 "parser.php5.c"
+#line 1208 "parser.php5.c"
       break;
     default:  break;   /* If no destructor action specified: do nothing */
   }
@@ -1413,8 +1446,11 @@ static struct {
   { 97, 7 },
   { 98, 8 },
   { 98, 9 },
+  { 98, 9 },
+  { 98, 10 },
   { 118, 1 },
   { 118, 1 },
+  { 119, 4 },
   { 104, 7 },
   { 99, 4 },
   { 100, 4 },
@@ -1479,19 +1515,19 @@ static struct {
   { 110, 5 },
   { 110, 5 },
   { 110, 6 },
-  { 120, 1 },
-  { 120, 1 },
-  { 119, 3 },
-  { 119, 1 },
-  { 121, 3 },
   { 121, 1 },
-  { 110, 1 },
-  { 122, 4 },
+  { 121, 1 },
+  { 120, 3 },
+  { 120, 1 },
   { 122, 3 },
+  { 122, 1 },
+  { 110, 1 },
+  { 123, 4 },
+  { 123, 3 },
   { 117, 3 },
   { 117, 1 },
-  { 123, 1 },
-  { 123, 3 },
+  { 124, 1 },
+  { 124, 3 },
   { 110, 1 },
   { 110, 1 },
   { 110, 1 },
@@ -1538,9 +1574,9 @@ static void yy_reduce(
       case 0:
 #line 164 "parser.php5.lemon"
 {
-	status->ret = yymsp[0].minor.yy40;
+	status->ret = yymsp[0].minor.yy158;
 }
-#line 1544 "parser.php5.c"
+#line 1580 "parser.php5.c"
         break;
       case 1:
       case 4:
@@ -1563,35 +1599,35 @@ static void yy_reduce(
       case 21:
       case 22:
       case 23:
-      case 138:
+      case 141:
 #line 168 "parser.php5.lemon"
 {
-	yygotominor.yy40 = yymsp[0].minor.yy40;
+	yygotominor.yy158 = yymsp[0].minor.yy158;
 }
-#line 1572 "parser.php5.c"
+#line 1608 "parser.php5.c"
         break;
       case 2:
 #line 178 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_zval_list(yymsp[-1].minor.yy40, yymsp[0].minor.yy40);
+	yygotominor.yy158 = phvolt_ret_zval_list(yymsp[-1].minor.yy158, yymsp[0].minor.yy158);
 }
-#line 1579 "parser.php5.c"
+#line 1615 "parser.php5.c"
         break;
       case 3:
       case 37:
       case 49:
-      case 135:
-      case 142:
+      case 138:
+      case 145:
 #line 182 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_zval_list(NULL, yymsp[0].minor.yy40);
+	yygotominor.yy158 = phvolt_ret_zval_list(NULL, yymsp[0].minor.yy158);
 }
-#line 1590 "parser.php5.c"
+#line 1626 "parser.php5.c"
         break;
       case 24:
 #line 278 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_if_statement(yymsp[-5].minor.yy40, yymsp[-3].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_if_statement(yymsp[-5].minor.yy158, yymsp[-3].minor.yy158, NULL, status->scanner_state);
   yy_destructor(1,&yymsp[-7].minor);
   yy_destructor(31,&yymsp[-6].minor);
   yy_destructor(32,&yymsp[-4].minor);
@@ -1599,12 +1635,12 @@ static void yy_reduce(
   yy_destructor(33,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1603 "parser.php5.c"
+#line 1639 "parser.php5.c"
         break;
       case 25:
 #line 282 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_if_statement(yymsp[-4].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_if_statement(yymsp[-4].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(1,&yymsp[-6].minor);
   yy_destructor(31,&yymsp[-5].minor);
   yy_destructor(32,&yymsp[-3].minor);
@@ -1612,12 +1648,12 @@ static void yy_reduce(
   yy_destructor(33,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1616 "parser.php5.c"
+#line 1652 "parser.php5.c"
         break;
       case 26:
 #line 286 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_if_statement(yymsp[-9].minor.yy40, yymsp[-7].minor.yy40, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_if_statement(yymsp[-9].minor.yy158, yymsp[-7].minor.yy158, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-11].minor);
   yy_destructor(31,&yymsp[-10].minor);
   yy_destructor(32,&yymsp[-8].minor);
@@ -1628,12 +1664,12 @@ static void yy_reduce(
   yy_destructor(33,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1632 "parser.php5.c"
+#line 1668 "parser.php5.c"
         break;
       case 27:
 #line 290 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_if_statement(yymsp[-8].minor.yy40, yymsp[-6].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_if_statement(yymsp[-8].minor.yy158, yymsp[-6].minor.yy158, NULL, status->scanner_state);
   yy_destructor(1,&yymsp[-10].minor);
   yy_destructor(31,&yymsp[-9].minor);
   yy_destructor(32,&yymsp[-7].minor);
@@ -1644,12 +1680,12 @@ static void yy_reduce(
   yy_destructor(33,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1648 "parser.php5.c"
+#line 1684 "parser.php5.c"
         break;
       case 28:
 #line 294 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_if_statement(yymsp[-7].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_if_statement(yymsp[-7].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(1,&yymsp[-9].minor);
   yy_destructor(31,&yymsp[-8].minor);
   yy_destructor(32,&yymsp[-6].minor);
@@ -1660,32 +1696,32 @@ static void yy_reduce(
   yy_destructor(33,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1664 "parser.php5.c"
+#line 1700 "parser.php5.c"
         break;
       case 29:
 #line 304 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_elseif_statement(yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_elseif_statement(yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-3].minor);
   yy_destructor(35,&yymsp[-2].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1674 "parser.php5.c"
+#line 1710 "parser.php5.c"
         break;
       case 30:
 #line 314 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_elsefor_statement(status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_elsefor_statement(status->scanner_state);
   yy_destructor(1,&yymsp[-2].minor);
   yy_destructor(36,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1684 "parser.php5.c"
+#line 1720 "parser.php5.c"
         break;
       case 31:
 #line 324 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_for_statement(yymsp[-7].minor.yy0, NULL, yymsp[-5].minor.yy40, NULL, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_for_statement(yymsp[-7].minor.yy0, NULL, yymsp[-5].minor.yy158, NULL, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-9].minor);
   yy_destructor(37,&yymsp[-8].minor);
   yy_destructor(3,&yymsp[-6].minor);
@@ -1694,12 +1730,12 @@ static void yy_reduce(
   yy_destructor(39,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1698 "parser.php5.c"
+#line 1734 "parser.php5.c"
         break;
       case 32:
 #line 328 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_for_statement(yymsp[-9].minor.yy0, NULL, yymsp[-7].minor.yy40, yymsp[-5].minor.yy40, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_for_statement(yymsp[-9].minor.yy0, NULL, yymsp[-7].minor.yy158, yymsp[-5].minor.yy158, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-11].minor);
   yy_destructor(37,&yymsp[-10].minor);
   yy_destructor(3,&yymsp[-8].minor);
@@ -1709,12 +1745,12 @@ static void yy_reduce(
   yy_destructor(39,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1713 "parser.php5.c"
+#line 1749 "parser.php5.c"
         break;
       case 33:
 #line 332 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_for_statement(yymsp[-7].minor.yy0, yymsp[-9].minor.yy0, yymsp[-5].minor.yy40, NULL, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_for_statement(yymsp[-7].minor.yy0, yymsp[-9].minor.yy0, yymsp[-5].minor.yy158, NULL, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-11].minor);
   yy_destructor(37,&yymsp[-10].minor);
   yy_destructor(2,&yymsp[-8].minor);
@@ -1724,12 +1760,12 @@ static void yy_reduce(
   yy_destructor(39,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1728 "parser.php5.c"
+#line 1764 "parser.php5.c"
         break;
       case 34:
 #line 336 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_for_statement(yymsp[-9].minor.yy0, yymsp[-11].minor.yy0, yymsp[-7].minor.yy40, yymsp[-5].minor.yy40, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_for_statement(yymsp[-9].minor.yy0, yymsp[-11].minor.yy0, yymsp[-7].minor.yy158, yymsp[-5].minor.yy158, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-13].minor);
   yy_destructor(37,&yymsp[-12].minor);
   yy_destructor(2,&yymsp[-10].minor);
@@ -1740,102 +1776,102 @@ static void yy_reduce(
   yy_destructor(39,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1744 "parser.php5.c"
+#line 1780 "parser.php5.c"
         break;
       case 35:
 #line 346 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_set_statement(yymsp[-1].minor.yy40);
+	yygotominor.yy158 = phvolt_ret_set_statement(yymsp[-1].minor.yy158);
   yy_destructor(1,&yymsp[-3].minor);
   yy_destructor(40,&yymsp[-2].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1754 "parser.php5.c"
+#line 1790 "parser.php5.c"
         break;
       case 36:
       case 48:
-      case 134:
-      case 141:
+      case 137:
+      case 144:
 #line 356 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_zval_list(yymsp[-2].minor.yy40, yymsp[0].minor.yy40);
+	yygotominor.yy158 = phvolt_ret_zval_list(yymsp[-2].minor.yy158, yymsp[0].minor.yy158);
   yy_destructor(2,&yymsp[-1].minor);
 }
-#line 1765 "parser.php5.c"
+#line 1801 "parser.php5.c"
         break;
       case 38:
 #line 370 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_set_assignment(yymsp[-2].minor.yy40, PHVOLT_T_ASSIGN, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_set_assignment(yymsp[-2].minor.yy158, PHVOLT_T_ASSIGN, yymsp[0].minor.yy158, status->scanner_state);
   yy_destructor(41,&yymsp[-1].minor);
 }
-#line 1773 "parser.php5.c"
+#line 1809 "parser.php5.c"
         break;
       case 39:
 #line 374 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_set_assignment(yymsp[-2].minor.yy40, PHVOLT_T_ADD_ASSIGN, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_set_assignment(yymsp[-2].minor.yy158, PHVOLT_T_ADD_ASSIGN, yymsp[0].minor.yy158, status->scanner_state);
   yy_destructor(42,&yymsp[-1].minor);
 }
-#line 1781 "parser.php5.c"
+#line 1817 "parser.php5.c"
         break;
       case 40:
 #line 378 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_set_assignment(yymsp[-2].minor.yy40, PHVOLT_T_SUB_ASSIGN, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_set_assignment(yymsp[-2].minor.yy158, PHVOLT_T_SUB_ASSIGN, yymsp[0].minor.yy158, status->scanner_state);
   yy_destructor(43,&yymsp[-1].minor);
 }
-#line 1789 "parser.php5.c"
+#line 1825 "parser.php5.c"
         break;
       case 41:
 #line 382 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_set_assignment(yymsp[-2].minor.yy40, PHVOLT_T_MUL_ASSIGN, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_set_assignment(yymsp[-2].minor.yy158, PHVOLT_T_MUL_ASSIGN, yymsp[0].minor.yy158, status->scanner_state);
   yy_destructor(44,&yymsp[-1].minor);
 }
-#line 1797 "parser.php5.c"
+#line 1833 "parser.php5.c"
         break;
       case 42:
 #line 386 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_set_assignment(yymsp[-2].minor.yy40, PHVOLT_T_DIV_ASSIGN, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_set_assignment(yymsp[-2].minor.yy158, PHVOLT_T_DIV_ASSIGN, yymsp[0].minor.yy158, status->scanner_state);
   yy_destructor(45,&yymsp[-1].minor);
 }
-#line 1805 "parser.php5.c"
+#line 1841 "parser.php5.c"
         break;
       case 43:
-      case 67:
-      case 133:
-      case 145:
+      case 69:
+      case 136:
+      case 148:
 #line 390 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_IDENTIFIER, yymsp[0].minor.yy0, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_IDENTIFIER, yymsp[0].minor.yy0, status->scanner_state);
 }
-#line 1815 "parser.php5.c"
+#line 1851 "parser.php5.c"
         break;
       case 44:
-      case 127:
+      case 130:
 #line 394 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ARRAYACCESS, yymsp[-3].minor.yy40, yymsp[-1].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ARRAYACCESS, yymsp[-3].minor.yy158, yymsp[-1].minor.yy158, NULL, status->scanner_state);
   yy_destructor(24,&yymsp[-2].minor);
   yy_destructor(46,&yymsp[0].minor);
 }
-#line 1825 "parser.php5.c"
+#line 1861 "parser.php5.c"
         break;
       case 45:
-      case 116:
+      case 119:
 #line 398 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_DOT, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_DOT, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(30,&yymsp[-1].minor);
 }
-#line 1834 "parser.php5.c"
+#line 1870 "parser.php5.c"
         break;
       case 46:
 #line 408 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_macro_statement(yymsp[-7].minor.yy0, NULL, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_macro_statement(yymsp[-7].minor.yy0, NULL, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-9].minor);
   yy_destructor(47,&yymsp[-8].minor);
   yy_destructor(29,&yymsp[-6].minor);
@@ -1845,12 +1881,12 @@ static void yy_reduce(
   yy_destructor(49,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1849 "parser.php5.c"
+#line 1885 "parser.php5.c"
         break;
       case 47:
 #line 412 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_macro_statement(yymsp[-8].minor.yy0, yymsp[-6].minor.yy40, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_macro_statement(yymsp[-8].minor.yy0, yymsp[-6].minor.yy158, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-10].minor);
   yy_destructor(47,&yymsp[-9].minor);
   yy_destructor(29,&yymsp[-7].minor);
@@ -1860,80 +1896,80 @@ static void yy_reduce(
   yy_destructor(49,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1864 "parser.php5.c"
+#line 1900 "parser.php5.c"
         break;
       case 50:
 #line 436 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_macro_parameter(yymsp[0].minor.yy0, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_macro_parameter(yymsp[0].minor.yy0, NULL, status->scanner_state);
 }
-#line 1871 "parser.php5.c"
+#line 1907 "parser.php5.c"
         break;
       case 51:
 #line 440 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_macro_parameter(yymsp[-2].minor.yy0, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_macro_parameter(yymsp[-2].minor.yy0, yymsp[0].minor.yy158, status->scanner_state);
   yy_destructor(41,&yymsp[-1].minor);
 }
-#line 1879 "parser.php5.c"
+#line 1915 "parser.php5.c"
         break;
       case 52:
-      case 66:
-      case 132:
-      case 146:
+      case 68:
+      case 135:
+      case 149:
 #line 444 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_INTEGER, yymsp[0].minor.yy0, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_INTEGER, yymsp[0].minor.yy0, status->scanner_state);
 }
-#line 1889 "parser.php5.c"
+#line 1925 "parser.php5.c"
         break;
       case 53:
-      case 147:
+      case 150:
 #line 448 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_STRING, yymsp[0].minor.yy0, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_STRING, yymsp[0].minor.yy0, status->scanner_state);
 }
-#line 1897 "parser.php5.c"
+#line 1933 "parser.php5.c"
         break;
       case 54:
-      case 148:
+      case 151:
 #line 452 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_DOUBLE, yymsp[0].minor.yy0, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_DOUBLE, yymsp[0].minor.yy0, status->scanner_state);
 }
-#line 1905 "parser.php5.c"
+#line 1941 "parser.php5.c"
         break;
       case 55:
-      case 149:
+      case 152:
 #line 456 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_NULL, NULL, status->scanner_state);
   yy_destructor(53,&yymsp[0].minor);
 }
-#line 1914 "parser.php5.c"
+#line 1950 "parser.php5.c"
         break;
       case 56:
-      case 150:
+      case 153:
 #line 460 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_FALSE, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_FALSE, NULL, status->scanner_state);
   yy_destructor(54,&yymsp[0].minor);
 }
-#line 1923 "parser.php5.c"
+#line 1959 "parser.php5.c"
         break;
       case 57:
-      case 151:
+      case 154:
 #line 464 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_TRUE, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_TRUE, NULL, status->scanner_state);
   yy_destructor(55,&yymsp[0].minor);
 }
-#line 1932 "parser.php5.c"
+#line 1968 "parser.php5.c"
         break;
       case 58:
 #line 474 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_macro_call_statement(yymsp[-8].minor.yy40, yymsp[-6].minor.yy40, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_macro_call_statement(yymsp[-8].minor.yy158, yymsp[-6].minor.yy158, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-10].minor);
   yy_destructor(56,&yymsp[-9].minor);
   yy_destructor(29,&yymsp[-7].minor);
@@ -1943,12 +1979,12 @@ static void yy_reduce(
   yy_destructor(57,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1947 "parser.php5.c"
+#line 1983 "parser.php5.c"
         break;
       case 59:
 #line 478 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_macro_call_statement(yymsp[-6].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_macro_call_statement(yymsp[-6].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(1,&yymsp[-8].minor);
   yy_destructor(56,&yymsp[-7].minor);
   yy_destructor(29,&yymsp[-5].minor);
@@ -1958,30 +1994,30 @@ static void yy_reduce(
   yy_destructor(57,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1962 "parser.php5.c"
+#line 1998 "parser.php5.c"
         break;
       case 60:
 #line 488 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_empty_statement(status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_empty_statement(status->scanner_state);
   yy_destructor(1,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1971 "parser.php5.c"
+#line 2007 "parser.php5.c"
         break;
       case 61:
 #line 498 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_echo_statement(yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_echo_statement(yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(58,&yymsp[-2].minor);
   yy_destructor(59,&yymsp[0].minor);
 }
-#line 1980 "parser.php5.c"
+#line 2016 "parser.php5.c"
         break;
       case 62:
 #line 508 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_block_statement(yymsp[-5].minor.yy0, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_block_statement(yymsp[-5].minor.yy0, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-7].minor);
   yy_destructor(60,&yymsp[-6].minor);
   yy_destructor(32,&yymsp[-4].minor);
@@ -1989,12 +2025,12 @@ static void yy_reduce(
   yy_destructor(61,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 1993 "parser.php5.c"
+#line 2029 "parser.php5.c"
         break;
       case 63:
 #line 512 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_block_statement(yymsp[-4].minor.yy0, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_block_statement(yymsp[-4].minor.yy0, NULL, status->scanner_state);
   yy_destructor(1,&yymsp[-6].minor);
   yy_destructor(60,&yymsp[-5].minor);
   yy_destructor(32,&yymsp[-3].minor);
@@ -2002,12 +2038,12 @@ static void yy_reduce(
   yy_destructor(61,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2006 "parser.php5.c"
+#line 2042 "parser.php5.c"
         break;
       case 64:
 #line 522 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_cache_statement(yymsp[-5].minor.yy40, NULL, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_cache_statement(yymsp[-5].minor.yy158, NULL, NULL, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-7].minor);
   yy_destructor(62,&yymsp[-6].minor);
   yy_destructor(32,&yymsp[-4].minor);
@@ -2015,12 +2051,12 @@ static void yy_reduce(
   yy_destructor(63,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2019 "parser.php5.c"
+#line 2055 "parser.php5.c"
         break;
       case 65:
 #line 526 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_cache_statement(yymsp[-6].minor.yy40, yymsp[-5].minor.yy40, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_cache_statement(yymsp[-6].minor.yy158, yymsp[-5].minor.yy158, NULL, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-8].minor);
   yy_destructor(62,&yymsp[-7].minor);
   yy_destructor(32,&yymsp[-4].minor);
@@ -2028,12 +2064,47 @@ static void yy_reduce(
   yy_destructor(63,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2032 "parser.php5.c"
+#line 2068 "parser.php5.c"
         break;
-      case 68:
-#line 550 "parser.php5.lemon"
+      case 66:
+#line 530 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_raw_statement(yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_cache_statement(yymsp[-6].minor.yy158, NULL, yymsp[-5].minor.yy158, yymsp[-3].minor.yy158, status->scanner_state);
+  yy_destructor(1,&yymsp[-8].minor);
+  yy_destructor(62,&yymsp[-7].minor);
+  yy_destructor(32,&yymsp[-4].minor);
+  yy_destructor(1,&yymsp[-2].minor);
+  yy_destructor(63,&yymsp[-1].minor);
+  yy_destructor(32,&yymsp[0].minor);
+}
+#line 2081 "parser.php5.c"
+        break;
+      case 67:
+#line 534 "parser.php5.lemon"
+{
+	yygotominor.yy158 = phvolt_ret_cache_statement(yymsp[-7].minor.yy158, yymsp[-6].minor.yy158, yymsp[-5].minor.yy158, yymsp[-3].minor.yy158, status->scanner_state);
+  yy_destructor(1,&yymsp[-9].minor);
+  yy_destructor(62,&yymsp[-8].minor);
+  yy_destructor(32,&yymsp[-4].minor);
+  yy_destructor(1,&yymsp[-2].minor);
+  yy_destructor(63,&yymsp[-1].minor);
+  yy_destructor(32,&yymsp[0].minor);
+}
+#line 2094 "parser.php5.c"
+        break;
+      case 70:
+#line 558 "parser.php5.lemon"
+{
+	yygotominor.yy158 = phvolt_ret_cache_tags(yymsp[-3].minor.yy0, yymsp[-1].minor.yy158, status->scanner_state);
+  yy_destructor(24,&yymsp[-2].minor);
+  yy_destructor(46,&yymsp[0].minor);
+}
+#line 2103 "parser.php5.c"
+        break;
+      case 71:
+#line 568 "parser.php5.lemon"
+{
+	yygotominor.yy158 = phvolt_ret_raw_statement(yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-6].minor);
   yy_destructor(64,&yymsp[-5].minor);
   yy_destructor(32,&yymsp[-4].minor);
@@ -2041,63 +2112,63 @@ static void yy_reduce(
   yy_destructor(65,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2045 "parser.php5.c"
+#line 2116 "parser.php5.c"
         break;
-      case 69:
-#line 560 "parser.php5.lemon"
+      case 72:
+#line 578 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_extends_statement(yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_extends_statement(yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-3].minor);
   yy_destructor(66,&yymsp[-2].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2055 "parser.php5.c"
+#line 2126 "parser.php5.c"
         break;
-      case 70:
-#line 570 "parser.php5.lemon"
+      case 73:
+#line 588 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_include_statement(yymsp[-1].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_include_statement(yymsp[-1].minor.yy158, NULL, status->scanner_state);
   yy_destructor(1,&yymsp[-3].minor);
   yy_destructor(67,&yymsp[-2].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2065 "parser.php5.c"
+#line 2136 "parser.php5.c"
         break;
-      case 71:
-#line 574 "parser.php5.lemon"
+      case 74:
+#line 592 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_include_statement(yymsp[-3].minor.yy40, yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_include_statement(yymsp[-3].minor.yy158, yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-5].minor);
   yy_destructor(67,&yymsp[-4].minor);
   yy_destructor(68,&yymsp[-2].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2076 "parser.php5.c"
+#line 2147 "parser.php5.c"
         break;
-      case 72:
-#line 584 "parser.php5.lemon"
+      case 75:
+#line 602 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_do_statement(yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_do_statement(yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-3].minor);
   yy_destructor(69,&yymsp[-2].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2086 "parser.php5.c"
+#line 2157 "parser.php5.c"
         break;
-      case 73:
-#line 594 "parser.php5.lemon"
+      case 76:
+#line 612 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_return_statement(yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_return_statement(yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-3].minor);
   yy_destructor(70,&yymsp[-2].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2096 "parser.php5.c"
+#line 2167 "parser.php5.c"
         break;
-      case 74:
-#line 604 "parser.php5.lemon"
+      case 77:
+#line 622 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_autoescape_statement(0, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_autoescape_statement(0, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-7].minor);
   yy_destructor(71,&yymsp[-6].minor);
   yy_destructor(54,&yymsp[-5].minor);
@@ -2106,12 +2177,12 @@ static void yy_reduce(
   yy_destructor(72,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2110 "parser.php5.c"
+#line 2181 "parser.php5.c"
         break;
-      case 75:
-#line 608 "parser.php5.lemon"
+      case 78:
+#line 626 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_autoescape_statement(1, yymsp[-3].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_autoescape_statement(1, yymsp[-3].minor.yy158, status->scanner_state);
   yy_destructor(1,&yymsp[-7].minor);
   yy_destructor(71,&yymsp[-6].minor);
   yy_destructor(55,&yymsp[-5].minor);
@@ -2120,506 +2191,506 @@ static void yy_reduce(
   yy_destructor(72,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2124 "parser.php5.c"
+#line 2195 "parser.php5.c"
         break;
-      case 76:
-#line 618 "parser.php5.lemon"
+      case 79:
+#line 636 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_break_statement(status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_break_statement(status->scanner_state);
   yy_destructor(1,&yymsp[-2].minor);
   yy_destructor(73,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2134 "parser.php5.c"
+#line 2205 "parser.php5.c"
         break;
-      case 77:
-#line 628 "parser.php5.lemon"
+      case 80:
+#line 646 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_continue_statement(status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_continue_statement(status->scanner_state);
   yy_destructor(1,&yymsp[-2].minor);
   yy_destructor(74,&yymsp[-1].minor);
   yy_destructor(32,&yymsp[0].minor);
 }
-#line 2144 "parser.php5.c"
+#line 2215 "parser.php5.c"
         break;
-      case 78:
-#line 638 "parser.php5.lemon"
+      case 81:
+#line 656 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_literal_zval(PHVOLT_T_RAW_FRAGMENT, yymsp[0].minor.yy0, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_literal_zval(PHVOLT_T_RAW_FRAGMENT, yymsp[0].minor.yy0, status->scanner_state);
 }
-#line 2151 "parser.php5.c"
+#line 2222 "parser.php5.c"
         break;
-      case 79:
-#line 648 "parser.php5.lemon"
+      case 82:
+#line 666 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_MINUS, NULL, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_MINUS, NULL, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(22,&yymsp[-1].minor);
 }
-#line 2159 "parser.php5.c"
+#line 2230 "parser.php5.c"
         break;
-      case 80:
-#line 652 "parser.php5.lemon"
+      case 83:
+#line 670 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_PLUS, NULL, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_PLUS, NULL, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(21,&yymsp[-1].minor);
 }
-#line 2167 "parser.php5.c"
+#line 2238 "parser.php5.c"
         break;
-      case 81:
-#line 656 "parser.php5.lemon"
+      case 84:
+#line 674 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_SUB, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_SUB, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(22,&yymsp[-1].minor);
 }
-#line 2175 "parser.php5.c"
+#line 2246 "parser.php5.c"
         break;
-      case 82:
-#line 660 "parser.php5.lemon"
+      case 85:
+#line 678 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ADD, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ADD, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(21,&yymsp[-1].minor);
 }
-#line 2183 "parser.php5.c"
+#line 2254 "parser.php5.c"
         break;
-      case 83:
-#line 664 "parser.php5.lemon"
+      case 86:
+#line 682 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_MUL, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_MUL, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(19,&yymsp[-1].minor);
 }
-#line 2191 "parser.php5.c"
+#line 2262 "parser.php5.c"
         break;
-      case 84:
-#line 668 "parser.php5.lemon"
+      case 87:
+#line 686 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_POW, yymsp[-3].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_POW, yymsp[-3].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(19,&yymsp[-2].minor);
   yy_destructor(19,&yymsp[-1].minor);
 }
-#line 2200 "parser.php5.c"
+#line 2271 "parser.php5.c"
         break;
-      case 85:
-#line 672 "parser.php5.lemon"
+      case 88:
+#line 690 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_DIV, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_DIV, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(18,&yymsp[-1].minor);
 }
-#line 2208 "parser.php5.c"
+#line 2279 "parser.php5.c"
         break;
-      case 86:
-#line 676 "parser.php5.lemon"
+      case 89:
+#line 694 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_MOD, yymsp[-3].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_MOD, yymsp[-3].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(18,&yymsp[-2].minor);
   yy_destructor(18,&yymsp[-1].minor);
 }
-#line 2217 "parser.php5.c"
+#line 2288 "parser.php5.c"
         break;
-      case 87:
-#line 680 "parser.php5.lemon"
+      case 90:
+#line 698 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_MOD, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_MOD, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(20,&yymsp[-1].minor);
 }
-#line 2225 "parser.php5.c"
+#line 2296 "parser.php5.c"
         break;
-      case 88:
-#line 684 "parser.php5.lemon"
+      case 91:
+#line 702 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_AND, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_AND, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(7,&yymsp[-1].minor);
 }
-#line 2233 "parser.php5.c"
+#line 2304 "parser.php5.c"
         break;
-      case 89:
-#line 688 "parser.php5.lemon"
+      case 92:
+#line 706 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_OR, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_OR, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(8,&yymsp[-1].minor);
 }
-#line 2241 "parser.php5.c"
+#line 2312 "parser.php5.c"
         break;
-      case 90:
-#line 692 "parser.php5.lemon"
+      case 93:
+#line 710 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_CONCAT, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_CONCAT, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(23,&yymsp[-1].minor);
 }
-#line 2249 "parser.php5.c"
+#line 2320 "parser.php5.c"
         break;
-      case 91:
-#line 696 "parser.php5.lemon"
+      case 94:
+#line 714 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_PIPE, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_PIPE, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(25,&yymsp[-1].minor);
 }
-#line 2257 "parser.php5.c"
+#line 2328 "parser.php5.c"
         break;
-      case 92:
-#line 700 "parser.php5.lemon"
+      case 95:
+#line 718 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_RANGE, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_RANGE, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(6,&yymsp[-1].minor);
 }
-#line 2265 "parser.php5.c"
+#line 2336 "parser.php5.c"
         break;
-      case 93:
-#line 704 "parser.php5.lemon"
+      case 96:
+#line 722 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_EQUALS, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_EQUALS, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(10,&yymsp[-1].minor);
 }
-#line 2273 "parser.php5.c"
+#line 2344 "parser.php5.c"
         break;
-      case 94:
-#line 708 "parser.php5.lemon"
+      case 97:
+#line 726 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_ISSET, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_ISSET, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
   yy_destructor(76,&yymsp[0].minor);
 }
-#line 2282 "parser.php5.c"
+#line 2353 "parser.php5.c"
         break;
-      case 95:
-#line 712 "parser.php5.lemon"
+      case 98:
+#line 730 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ISSET, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ISSET, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
   yy_destructor(76,&yymsp[0].minor);
 }
-#line 2291 "parser.php5.c"
+#line 2362 "parser.php5.c"
         break;
-      case 96:
-#line 716 "parser.php5.lemon"
+      case 99:
+#line 734 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_ISEMPTY, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_ISEMPTY, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
   yy_destructor(77,&yymsp[0].minor);
 }
-#line 2300 "parser.php5.c"
+#line 2371 "parser.php5.c"
         break;
-      case 97:
-#line 720 "parser.php5.lemon"
+      case 100:
+#line 738 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ISEMPTY, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ISEMPTY, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
   yy_destructor(77,&yymsp[0].minor);
 }
-#line 2309 "parser.php5.c"
+#line 2380 "parser.php5.c"
         break;
-      case 98:
-#line 724 "parser.php5.lemon"
+      case 101:
+#line 742 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_ISEVEN, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_ISEVEN, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
   yy_destructor(78,&yymsp[0].minor);
 }
-#line 2318 "parser.php5.c"
+#line 2389 "parser.php5.c"
         break;
-      case 99:
-#line 728 "parser.php5.lemon"
+      case 102:
+#line 746 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ISEVEN, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ISEVEN, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
   yy_destructor(78,&yymsp[0].minor);
 }
-#line 2327 "parser.php5.c"
+#line 2398 "parser.php5.c"
         break;
-      case 100:
-#line 732 "parser.php5.lemon"
+      case 103:
+#line 750 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_ISODD, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_ISODD, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
   yy_destructor(79,&yymsp[0].minor);
 }
-#line 2336 "parser.php5.c"
+#line 2407 "parser.php5.c"
         break;
-      case 101:
-#line 736 "parser.php5.lemon"
+      case 104:
+#line 754 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ISODD, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ISODD, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
   yy_destructor(79,&yymsp[0].minor);
 }
-#line 2345 "parser.php5.c"
+#line 2416 "parser.php5.c"
         break;
-      case 102:
-#line 740 "parser.php5.lemon"
+      case 105:
+#line 758 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_ISNUMERIC, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_ISNUMERIC, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
   yy_destructor(80,&yymsp[0].minor);
 }
-#line 2354 "parser.php5.c"
+#line 2425 "parser.php5.c"
         break;
-      case 103:
-#line 744 "parser.php5.lemon"
+      case 106:
+#line 762 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ISNUMERIC, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ISNUMERIC, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
   yy_destructor(80,&yymsp[0].minor);
 }
-#line 2363 "parser.php5.c"
+#line 2434 "parser.php5.c"
         break;
-      case 104:
-#line 748 "parser.php5.lemon"
+      case 107:
+#line 766 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_ISSCALAR, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_ISSCALAR, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
   yy_destructor(81,&yymsp[0].minor);
 }
-#line 2372 "parser.php5.c"
+#line 2443 "parser.php5.c"
         break;
-      case 105:
-#line 752 "parser.php5.lemon"
+      case 108:
+#line 770 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ISSCALAR, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ISSCALAR, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
   yy_destructor(81,&yymsp[0].minor);
 }
-#line 2381 "parser.php5.c"
+#line 2452 "parser.php5.c"
         break;
-      case 106:
-#line 756 "parser.php5.lemon"
+      case 109:
+#line 774 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_ISITERABLE, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_ISITERABLE, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
   yy_destructor(82,&yymsp[0].minor);
 }
-#line 2390 "parser.php5.c"
+#line 2461 "parser.php5.c"
         break;
-      case 107:
-#line 760 "parser.php5.lemon"
+      case 110:
+#line 778 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ISITERABLE, yymsp[-2].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ISITERABLE, yymsp[-2].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
   yy_destructor(82,&yymsp[0].minor);
 }
-#line 2399 "parser.php5.c"
+#line 2470 "parser.php5.c"
         break;
-      case 108:
-#line 764 "parser.php5.lemon"
+      case 111:
+#line 782 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_IS, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_IS, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(9,&yymsp[-1].minor);
 }
-#line 2407 "parser.php5.c"
+#line 2478 "parser.php5.c"
         break;
-      case 109:
-#line 768 "parser.php5.lemon"
+      case 112:
+#line 786 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOTEQUALS, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOTEQUALS, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(11,&yymsp[-1].minor);
 }
-#line 2415 "parser.php5.c"
+#line 2486 "parser.php5.c"
         break;
-      case 110:
-#line 772 "parser.php5.lemon"
+      case 113:
+#line 790 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_IDENTICAL, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_IDENTICAL, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(16,&yymsp[-1].minor);
 }
-#line 2423 "parser.php5.c"
+#line 2494 "parser.php5.c"
         break;
-      case 111:
-#line 776 "parser.php5.lemon"
+      case 114:
+#line 794 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOTIDENTICAL, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOTIDENTICAL, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(17,&yymsp[-1].minor);
 }
-#line 2431 "parser.php5.c"
+#line 2502 "parser.php5.c"
         break;
-      case 112:
-#line 780 "parser.php5.lemon"
+      case 115:
+#line 798 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_LESS, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_LESS, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(12,&yymsp[-1].minor);
 }
-#line 2439 "parser.php5.c"
+#line 2510 "parser.php5.c"
         break;
-      case 113:
-#line 784 "parser.php5.lemon"
+      case 116:
+#line 802 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_GREATER, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_GREATER, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(13,&yymsp[-1].minor);
 }
-#line 2447 "parser.php5.c"
+#line 2518 "parser.php5.c"
         break;
-      case 114:
-#line 788 "parser.php5.lemon"
+      case 117:
+#line 806 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_GREATEREQUAL, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_GREATEREQUAL, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(14,&yymsp[-1].minor);
 }
-#line 2455 "parser.php5.c"
+#line 2526 "parser.php5.c"
         break;
-      case 115:
-#line 792 "parser.php5.lemon"
+      case 118:
+#line 810 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_LESSEQUAL, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_LESSEQUAL, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(15,&yymsp[-1].minor);
 }
-#line 2463 "parser.php5.c"
+#line 2534 "parser.php5.c"
         break;
-      case 117:
-#line 800 "parser.php5.lemon"
+      case 120:
+#line 818 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_IN, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_IN, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(3,&yymsp[-1].minor);
 }
-#line 2471 "parser.php5.c"
+#line 2542 "parser.php5.c"
         break;
-      case 118:
-#line 804 "parser.php5.lemon"
+      case 121:
+#line 822 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT_IN, yymsp[-3].minor.yy40, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT_IN, yymsp[-3].minor.yy158, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(26,&yymsp[-2].minor);
   yy_destructor(3,&yymsp[-1].minor);
 }
-#line 2480 "parser.php5.c"
+#line 2551 "parser.php5.c"
         break;
-      case 119:
-#line 808 "parser.php5.lemon"
+      case 122:
+#line 826 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_NOT, NULL, yymsp[0].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_NOT, NULL, yymsp[0].minor.yy158, NULL, status->scanner_state);
   yy_destructor(26,&yymsp[-1].minor);
 }
-#line 2488 "parser.php5.c"
+#line 2559 "parser.php5.c"
         break;
-      case 120:
-#line 812 "parser.php5.lemon"
+      case 123:
+#line 830 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_INCR, yymsp[-1].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_INCR, yymsp[-1].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(27,&yymsp[0].minor);
 }
-#line 2496 "parser.php5.c"
+#line 2567 "parser.php5.c"
         break;
-      case 121:
-#line 816 "parser.php5.lemon"
+      case 124:
+#line 834 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_DECR, yymsp[-1].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_DECR, yymsp[-1].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(28,&yymsp[0].minor);
 }
-#line 2504 "parser.php5.c"
+#line 2575 "parser.php5.c"
         break;
-      case 122:
-#line 820 "parser.php5.lemon"
+      case 125:
+#line 838 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ENCLOSED, yymsp[-1].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ENCLOSED, yymsp[-1].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(29,&yymsp[-2].minor);
   yy_destructor(48,&yymsp[0].minor);
 }
-#line 2513 "parser.php5.c"
+#line 2584 "parser.php5.c"
         break;
-      case 123:
-#line 824 "parser.php5.lemon"
+      case 126:
+#line 842 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
   yy_destructor(24,&yymsp[-1].minor);
   yy_destructor(46,&yymsp[0].minor);
 }
-#line 2522 "parser.php5.c"
+#line 2593 "parser.php5.c"
         break;
-      case 124:
-#line 828 "parser.php5.lemon"
+      case 127:
+#line 846 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ARRAY, yymsp[-1].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ARRAY, yymsp[-1].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(24,&yymsp[-2].minor);
   yy_destructor(46,&yymsp[0].minor);
 }
-#line 2531 "parser.php5.c"
+#line 2602 "parser.php5.c"
         break;
-      case 125:
-#line 832 "parser.php5.lemon"
+      case 128:
+#line 850 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ARRAY, NULL, NULL, NULL, status->scanner_state);
   yy_destructor(83,&yymsp[-1].minor);
   yy_destructor(84,&yymsp[0].minor);
 }
-#line 2540 "parser.php5.c"
+#line 2611 "parser.php5.c"
         break;
-      case 126:
-#line 836 "parser.php5.lemon"
+      case 129:
+#line 854 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_ARRAY, yymsp[-1].minor.yy40, NULL, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_ARRAY, yymsp[-1].minor.yy158, NULL, NULL, status->scanner_state);
   yy_destructor(83,&yymsp[-2].minor);
   yy_destructor(84,&yymsp[0].minor);
 }
-#line 2549 "parser.php5.c"
+#line 2620 "parser.php5.c"
         break;
-      case 128:
-#line 844 "parser.php5.lemon"
+      case 131:
+#line 862 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_expr(PHVOLT_T_TERNARY, yymsp[-2].minor.yy40, yymsp[0].minor.yy40, yymsp[-4].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_expr(PHVOLT_T_TERNARY, yymsp[-2].minor.yy158, yymsp[0].minor.yy158, yymsp[-4].minor.yy158, status->scanner_state);
   yy_destructor(4,&yymsp[-3].minor);
   yy_destructor(5,&yymsp[-1].minor);
 }
-#line 2558 "parser.php5.c"
+#line 2629 "parser.php5.c"
         break;
-      case 129:
-#line 848 "parser.php5.lemon"
+      case 132:
+#line 866 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_slice(yymsp[-4].minor.yy40, NULL, yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_slice(yymsp[-4].minor.yy158, NULL, yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(24,&yymsp[-3].minor);
   yy_destructor(5,&yymsp[-2].minor);
   yy_destructor(46,&yymsp[0].minor);
 }
-#line 2568 "parser.php5.c"
+#line 2639 "parser.php5.c"
         break;
-      case 130:
-#line 852 "parser.php5.lemon"
+      case 133:
+#line 870 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_slice(yymsp[-4].minor.yy40, yymsp[-2].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_slice(yymsp[-4].minor.yy158, yymsp[-2].minor.yy158, NULL, status->scanner_state);
   yy_destructor(24,&yymsp[-3].minor);
   yy_destructor(5,&yymsp[-1].minor);
   yy_destructor(46,&yymsp[0].minor);
 }
-#line 2578 "parser.php5.c"
+#line 2649 "parser.php5.c"
         break;
-      case 131:
-#line 856 "parser.php5.lemon"
+      case 134:
+#line 874 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_slice(yymsp[-5].minor.yy40, yymsp[-3].minor.yy40, yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_slice(yymsp[-5].minor.yy158, yymsp[-3].minor.yy158, yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(24,&yymsp[-4].minor);
   yy_destructor(5,&yymsp[-2].minor);
   yy_destructor(46,&yymsp[0].minor);
 }
-#line 2588 "parser.php5.c"
+#line 2659 "parser.php5.c"
         break;
-      case 136:
-      case 144:
-#line 894 "parser.php5.lemon"
+      case 139:
+      case 147:
+#line 912 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_named_item(yymsp[-2].minor.yy0, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_named_item(yymsp[-2].minor.yy0, yymsp[0].minor.yy158, status->scanner_state);
   yy_destructor(5,&yymsp[-1].minor);
 }
-#line 2597 "parser.php5.c"
+#line 2668 "parser.php5.c"
         break;
-      case 137:
-      case 143:
-#line 898 "parser.php5.lemon"
+      case 140:
+      case 146:
+#line 916 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_named_item(NULL, yymsp[0].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_named_item(NULL, yymsp[0].minor.yy158, status->scanner_state);
 }
-#line 2605 "parser.php5.c"
+#line 2676 "parser.php5.c"
         break;
-      case 139:
-#line 912 "parser.php5.lemon"
+      case 142:
+#line 930 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_func_call(yymsp[-3].minor.yy40, yymsp[-1].minor.yy40, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_func_call(yymsp[-3].minor.yy158, yymsp[-1].minor.yy158, status->scanner_state);
   yy_destructor(29,&yymsp[-2].minor);
   yy_destructor(48,&yymsp[0].minor);
 }
-#line 2614 "parser.php5.c"
+#line 2685 "parser.php5.c"
         break;
-      case 140:
-#line 916 "parser.php5.lemon"
+      case 143:
+#line 934 "parser.php5.lemon"
 {
-	yygotominor.yy40 = phvolt_ret_func_call(yymsp[-2].minor.yy40, NULL, status->scanner_state);
+	yygotominor.yy158 = phvolt_ret_func_call(yymsp[-2].minor.yy158, NULL, status->scanner_state);
   yy_destructor(29,&yymsp[-1].minor);
   yy_destructor(48,&yymsp[0].minor);
 }
-#line 2623 "parser.php5.c"
+#line 2694 "parser.php5.c"
         break;
   };
   yygoto = yyRuleInfo[yyruleno].lhs;
@@ -2770,7 +2841,7 @@ static void yy_syntax_error(
 
 	status->status = PHVOLT_PARSING_FAILED;
 
-#line 2774 "parser.php5.c"
+#line 2845 "parser.php5.c"
   phvolt_ARG_STORE; /* Suppress warning about unused %extra_argument variable */
 }
 
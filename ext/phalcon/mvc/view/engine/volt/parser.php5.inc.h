@@ -128,7 +128,7 @@ static zval *phvolt_ret_for_statement(phvolt_parser_token *variable, phvolt_pars
 	return ret;
 }
 
-static zval *phvolt_ret_cache_statement(zval *expr, zval *lifetime, zval *block_statements, phvolt_scanner_state *state)
+static zval *phvolt_ret_cache_statement(zval *expr, zval *lifetime, zval *tags, zval *block_statements, phvolt_scanner_state *state)
 {
 	PHVOLT_DEFINE_INIT_ZVAL(ret);
 
@@ -140,6 +140,10 @@ static zval *phvolt_ret_cache_statement(zval *expr, zval *lifetime, zval *block_
 	if (lifetime) {
 		add_assoc_zval(ret, "lifetime", lifetime);
 	}
+
+	if (tags) {
+		add_assoc_zval(ret, "tags", tags);
+	}
 	add_assoc_zval(ret, "block_statements", block_statements);
 
 	PHVOLT_ADDREF_P(state->active_file);
@@ -508,6 +512,16 @@ static zval *phvolt_ret_expr(int type, zval *left, zval *right, zval *ternary, p
 	return ret;
 }
 
+static zval *phvolt_ret_cache_tags(phvolt_parser_token *I, zval *tags, phvolt_scanner_state *state)
+{
+	zval *ret = phvolt_ret_expr(PHVOLT_T_ARRAY, tags, NULL, NULL, state);
+
+	phvolt_add_assoc_stringl(ret, "name", I->token, I->token_len, 0);
+	efree(I);
+
+	return ret;
+}
+
 static zval *phvolt_ret_slice(zval *left, zval *start, zval *end, phvolt_scanner_state *state)
 {
 	PHVOLT_DEFINE_INIT_ZVAL(ret);
@@ -102,7 +102,7 @@ static void phvolt_ret_for_statement(zval *ret, phvolt_parser_token *variable, p
 	add_assoc_long(ret, "line", state->active_line);
 }
 
-static void phvolt_ret_cache_statement(zval *ret, zval *expr, zval *lifetime, zval *block_statements, phvolt_scanner_state *state)
+static void phvolt_ret_cache_statement(zval *ret, zval *expr, zval *lifetime, zval *tags, zval *block_statements, phvolt_scanner_state *state)
 {
 	array_init(ret);
 
@@ -112,6 +112,10 @@ static void phvolt_ret_cache_statement(zval *ret, zval *expr, zval *lifetime, zv
 	if (lifetime) {
 		add_assoc_zval(ret, "lifetime", lifetime);
 	}
+
+	if (tags) {
+		add_assoc_zval(ret, "tags", tags);
+	}
 	add_assoc_zval(ret, "block_statements", block_statements);
 
 	Z_TRY_ADDREF_P(state->active_file);
@@ -382,6 +386,15 @@ static void phvolt_ret_expr(zval *ret, int type, zval *left, zval *right, zval *
 	add_assoc_long(ret, "line", state->active_line);
 }
 
+static void phvolt_ret_cache_tags(zval *ret, phvolt_parser_token *I, zval *tags, phvolt_scanner_state *state)
+{
+	phvolt_ret_expr(ret, PHVOLT_T_ARRAY, tags, NULL, NULL, state);
+
+	phvolt_add_assoc_stringl(ret, "name", I->token, I->token_len, 0);
+	efree(I->token);
+	efree(I);
+}
+
 static void phvolt_ret_slice(zval *ret, zval *left, zval *start, zval *end, phvolt_scanner_state *state)
 {
 	array_init(ret);
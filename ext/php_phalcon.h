@@ -37,6 +37,8 @@ typedef struct _zephir_struct_orm {
 	zend_bool enable_implicit_joins;
 	zend_bool cast_on_hydrate;
 	zend_bool ignore_unknown_columns;
+	zend_bool persistent_ast_cache;
+	int persistent_ast_cache_size;
 } zephir_struct_orm;
 
 
@@ -0,0 +1,47 @@
+<?php
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Zephir\Optimizers\FunctionCall;
+
+use Zephir\Call;
+use Zephir\CompilationContext;
+use Zephir\CompilerException;
+use Zephir\CompiledExpression;
+use Zephir\Optimizers\OptimizerAbstract;
+
+class PhalconOrmAstCacheClearOptimizer extends OptimizerAbstract
+{
+	/**
+	 * @param array $expression
+	 * @param Call $call
+	 * @param CompilationContext $context
+	 * @return bool|CompiledExpression|mixed
+	 * @throws CompilerException
+	 */
+	public function optimize(array $expression, Call $call, CompilationContext $context)
+	{
+
+		$context->headersManager->add('phalcon/mvc/model/orm');
+
+		$context->codePrinter->output('phalcon_orm_ast_cache_clear(TSRMLS_C);');
+
+		return new CompiledExpression('null', null, $expression);
+	}
+}
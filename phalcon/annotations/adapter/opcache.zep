@@ -0,0 +1,237 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Annotations\Adapter;
+
+use Phalcon\Annotations\Adapter;
+use Phalcon\Annotations\Reflection;
+use Phalcon\Annotations\Exception;
+
+/**
+ * Phalcon\Annotations\Adapter\Opcache
+ *
+ * Stores the parsed annotations in PHP files returning plain arrays. Opcache
+ * keeps those arrays immutable in shared memory, so every worker reads them
+ * without parsing docblocks or unserializing objects. The entries are
+ * validated against the modification time of the file declaring the class.
+ * This adapter is suitable for production
+ *
+ *<code>
+ * use Phalcon\Annotations\Adapter\Opcache;
+ *
+ * $annotations = new Opcache(
+ *     [
+ *         "annotationsDir" => "app/cache/annotations/",
+ *         "stat"           => true,
+ *     ]
+ * );
+ *
+ * // At deploy time
+ * $annotations->preload("app/controllers/", "App\\Controllers");
+ *</code>
+ */
+class Opcache extends Adapter
+{
+	protected _annotationsDir = "./";
+
+	protected _stat = true;
+
+	/**
+	 * Entries already loaded by the process, indexed by path
+	 */
+	protected static _entries = [];
+
+	/**
+	 * Phalcon\Annotations\Adapter\Opcache constructor
+	 *
+	 * @param array options
+	 */
+	public function __construct(options = null)
+	{
+		var annotationsDir, stat;
+
+		if typeof options == "array" {
+			if fetch annotationsDir, options["annotationsDir"] {
+				let this->_annotationsDir = annotationsDir;
+			}
+			if fetch stat, options["stat"] {
+				let this->_stat = (bool) stat;
+			}
+		}
+	}
+
+	/**
+	 * Reads parsed annotations from the shared files. Entries of classes whose
+	 * file was modified after they were parsed are ignored
+	 */
+	public function read(string! key) -> <Reflection> | boolean
+	{
+		var path, entry, file, entries;
+
+		let path = this->_getPath(key);
+
+		if !fetch entry, self::_entries[path] {
+			if !file_exists(path) {
+				return false;
+			}
+			let entry = require path;
+			if typeof entry != "array" {
+				return false;
+			}
+			let self::_entries[path] = entry;
+		}
+
+		if this->_stat {
+			if fetch file, entry["file"] {
+				if typeof file == "string" {
+					if !file_exists(file) || filemtime(file) != entry["mtime"] {
+						let entries = self::_entries;
+						unset entries[path];
+						let self::_entries = entries;
+						return false;
+					}
+				}
+			}
+		}
+
+		return new Reflection(entry["data"]);
+	}
+
+	/**
+	 * Writes parsed annotations to the shared files
+	 */
+	public function write(string! key, <Reflection> data)
+	{
+		var path, file, mtime, entry, temporary, reflection;
+
+		let path = this->_getPath(key),
+			file = false,
+			mtime = 0;
+
+		if class_exists(key) || interface_exists(key) {
+			let reflection = new \ReflectionClass(key),
+				file = reflection->getFileName();
+			if typeof file == "string" {
+				let mtime = filemtime(file);
+			}
+		}
+
+		let entry = [
+			"file":  file,
+			"mtime": mtime,
+			"data":  data->getReflectionData()
+		];
+
+		/**
+		 * The file is replaced atomically so other workers never include a partial entry
+		 */
+		let temporary = path . "." . uniqid("", true);
+		if file_put_contents(temporary, "<?php return " . var_export(entry, true) . "; ") === false {
+			throw new Exception("Annotations directory cannot be written");
+		}
+
+		if !rename(temporary, path) {
+			unlink(temporary);
+			throw new Exception("Annotations directory cannot be written");
+		}
+
+		if function_exists("opcache_invalidate") {
+			opcache_invalidate(path, true);
+		}
+
+		let self::_entries[path] = entry;
+	}
+
+	/**
+	 * Parses the annotations of every class in a directory and its
+	 * subdirectories, returning the names of the classes stored
+	 *
+	 *<code>
+	 * $annotations->preload("app/controllers/", "App\\Controllers");
+	 * $annotations->preload("app/models/", "App\\Models");
+	 *</code>
+	 */
+	public function preload(string! directory, string namespaceName = null) -> array
+	{
+		var reader, classes, className, parsedAnnotations;
+
+		let reader = this->getReader(),
+			classes = [];
+
+		for className in this->_getClassesFromDirectory(directory, (string) namespaceName) {
+			let parsedAnnotations = reader->parse(className);
+			if typeof parsedAnnotations == "array" {
+				this->write(className, new Reflection(parsedAnnotations));
+				let classes[] = className;
+			}
+		}
+
+		return classes;
+	}
+
+	/**
+	 * Clears the entries loaded by the process
+	 */
+	public static function reset() -> void
+	{
+		let self::_entries = [];
+	}
+
+	/**
+	 * Returns the path of the file storing the annotations of a class
+	 */
+	protected function _getPath(string! key) -> string
+	{
+		/**
+		 * Paths must be normalized before be used as keys
+		 */
+		return this->_annotationsDir . prepare_virtual_path(key, "_") . ".php";
+	}
+
+	/**
+	 * Returns the classes declared in a directory and its subdirectories
+	 */
+	protected function _getClassesFromDirectory(string! directory, string! namespaceName) -> array
+	{
+		var classes, file, className, subDirectory;
+
+		let directory = rtrim(directory, "\\/") . DIRECTORY_SEPARATOR,
+			classes = [];
+
+		if namespaceName !== "" {
+			let namespaceName = rtrim(namespaceName, "\\") . "\\";
+		}
+
+		for file in glob(directory . "*.php") {
+			let className = namespaceName . basename(file, ".php");
+			if class_exists(className) {
+				let classes[] = className;
+			}
+		}
+
+		for subDirectory in glob(directory . "*", GLOB_ONLYDIR) {
+			let classes = array_merge(
+				classes,
+				this->_getClassesFromDirectory(subDirectory, namespaceName . basename(subDirectory))
+			);
+		}
+
+		return classes;
+	}
+}
@@ -136,4 +136,333 @@ abstract class Backend implements BackendInterface
 	{
 		return this->_lastLifetime;
 	}
+
+	/**
+	 * Returns the cached content of a key, computing and storing it with the
+	 * callable when it is missing. Only the worker holding a short-lived lock
+	 * key recomputes it, the others wait for the new content with backoff.
+	 * The content may be recomputed before it expires with a probability that
+	 * grows as the expiration gets closer and with the time it took to compute
+	 * (XFetch), meanwhile the current content is served
+	 *
+	 *<code>
+	 * $robots = $cache->remember(
+	 *     "robots",
+	 *     3600,
+	 *     function () {
+	 *         return Robots::find();
+	 *     }
+	 * );
+	 *</code>
+	 *
+	 * The "beta" option of the backend scales the early expiration (0 disables
+	 * it, 1 by default), "lockLifetime" limits the time a worker holds the lock
+	 * (10 seconds by default) and "lockWait" the time other workers wait for
+	 * the content (5 seconds by default)
+	 */
+	public function remember(var keyName, lifetime, callable computer, array parameters = [])
+	{
+		var metaKey, lockKey, contents, content, meta, beta, lockLifetime, lockWait, start, delta, items, ttl, e;
+		boolean locked = false;
+		int waited = 0, backoff = 10;
+
+		let metaKey = "_PHCM" . keyName,
+			lockKey = "_PHCL" . keyName,
+			beta = this->_getOption("beta", 1.0),
+			lockLifetime = (int) this->_getOption("lockLifetime", 10),
+			lockWait = (int) this->_getOption("lockWait", 5) * 1000;
+
+		/**
+		 * The expiration stored with the content must be the one used to save it
+		 */
+		if lifetime === null {
+			let ttl = this->_lastLifetime;
+			if !ttl {
+				let ttl = this->_frontend->getLifetime();
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		let contents = this->getMany([keyName, metaKey], lifetime),
+			content = contents[keyName],
+			meta = contents[metaKey];
+
+		if content !== null {
+
+			let this->_fresh = false;
+
+			if typeof meta != "array" || beta <= 0 {
+				return content;
+			}
+
+			/**
+			 * XFetch: now - delta * beta * log(random) >= expiration
+			 */
+			if microtime(true) - meta[0] * beta * log((mt_rand() + 1) / (mt_getrandmax() + 1)) < meta[1] {
+				return content;
+			}
+
+			/**
+			 * Another worker is already recomputing it
+			 */
+			if !this->_acquireLock(lockKey, lockLifetime) {
+				return content;
+			}
+
+			let locked = true;
+
+		} else {
+
+			let locked = this->_acquireLock(lockKey, lockLifetime);
+
+			if !locked {
+				while waited < lockWait {
+					usleep(backoff * 1000);
+
+					let waited += backoff,
+						backoff = min(backoff * 2, 200);
+
+					let content = this->{"get"}(keyName, lifetime);
+					if content !== null {
+						let this->_fresh = false;
+						return content;
+					}
+				}
+			}
+		}
+
+		let start = microtime(true);
+
+		try {
+			let content = call_user_func_array(computer, parameters);
+		} catch \Exception, e {
+			if locked {
+				this->{"delete"}(lockKey);
+			}
+			throw e;
+		}
+
+		let delta = microtime(true) - start;
+
+		/**
+		 * The content and the time it took to compute it are stored together
+		 */
+		if content !== null {
+			let items = [],
+				items[keyName] = content,
+				items[metaKey] = [delta, time() + ttl];
+
+			this->saveMany(items, ttl);
+		}
+
+		if locked {
+			this->{"delete"}(lockKey);
+		}
+
+		let this->_fresh = true;
+
+		return content;
+	}
+
+	/**
+	 * Returns the cached contents of several keys, indexed by key. Missing or
+	 * expired keys are returned as null. Adapters able to fetch several keys
+	 * in one round-trip override this method
+	 *
+	 *<code>
+	 * $contents = $cache->getMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function getMany(array! keys, lifetime = null) -> array
+	{
+		var keyName, contents;
+
+		let contents = [];
+		for keyName in keys {
+			let contents[keyName] = this->{"get"}(keyName, lifetime);
+		}
+
+		return contents;
+	}
+
+	/**
+	 * Stores several contents indexed by key without stopping the frontend
+	 *
+	 *<code>
+	 * $cache->saveMany(
+	 *     [
+	 *         "my-key"       => $data,
+	 *         "my-other-key" => $otherData,
+	 *     ],
+	 *     3600
+	 * );
+	 *</code>
+	 */
+	public function saveMany(array! items, lifetime = null) -> boolean
+	{
+		var keyName, content;
+		boolean success = true;
+
+		for keyName, content in items {
+			if !this->{"save"}(keyName, content, lifetime, false) {
+				let success = false;
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * Deletes several keys, returns true if all of them were deleted
+	 *
+	 *<code>
+	 * $cache->deleteMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function deleteMany(array! keys) -> boolean
+	{
+		var keyName;
+		boolean success = true;
+
+		for keyName in keys {
+			if !this->{"delete"}(keyName) {
+				let success = false;
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * Returns the key of a fragment that depends on several tags. The key includes
+	 * the current version of every tag, invalidating a tag changes the keys of all
+	 * the fragments tagged with it
+	 *
+	 *<code>
+	 * $key = $cache->getTaggedKey("sidebar", ["user:5", "catalog"]);
+	 *
+	 * $content = $cache->start($key);
+	 *</code>
+	 */
+	public function getTaggedKey(var keyName, array! tags) -> string
+	{
+		var tag, versions, lastKey;
+
+		if !count(tags) {
+			return (string) keyName;
+		}
+
+		let lastKey = this->_lastKey,
+			versions = [];
+
+		for tag in tags {
+			let versions[] = this->_getTagVersion(tag);
+		}
+
+		let this->_lastKey = lastKey;
+
+		return keyName . "." . md5(join(".", versions));
+	}
+
+	/**
+	 * Invalidates every fragment tagged with a tag by changing its version
+	 *
+	 *<code>
+	 * $cache->invalidateTag("user:5");
+	 *</code>
+	 */
+	public function invalidateTag(string! tag) -> boolean
+	{
+		var lastKey, status;
+
+		let lastKey = this->_lastKey,
+			status = this->_saveSilently("_PHCT_" . tag, uniqid("", true), this->_getTagsLifetime()),
+			this->_lastKey = lastKey;
+
+		return status;
+	}
+
+	/**
+	 * Returns the current version of a tag, creating it the first time
+	 */
+	protected function _getTagVersion(string! tag) -> string
+	{
+		var tagKey, version;
+
+		let tagKey = "_PHCT_" . tag,
+			version = this->{"get"}(tagKey, this->_getTagsLifetime());
+
+		if version === null {
+			let version = uniqid("", true);
+			this->_saveSilently(tagKey, version, this->_getTagsLifetime());
+		}
+
+		return (string) version;
+	}
+
+	/**
+	 * Stores an internal value without stopping the fragment being cached.
+	 * Adapters echo the stored content while the frontend is buffering, so it
+	 * is discarded here
+	 */
+	protected function _saveSilently(string! keyName, var content, var lifetime) -> boolean
+	{
+		var status, started, e;
+
+		let started = this->_started;
+
+		ob_start();
+		try {
+			let status = this->{"save"}(keyName, content, lifetime, false);
+		} catch \Exception, e {
+			ob_end_clean();
+			throw e;
+		}
+		ob_end_clean();
+
+		let this->_started = started;
+
+		return status;
+	}
+
+	/**
+	 * Returns the lifetime of the tag versions, a month by default
+	 */
+	protected function _getTagsLifetime() -> int
+	{
+		var tagsLifetime;
+
+		if fetch tagsLifetime, this->_options["tagsLifetime"] {
+			return (int) tagsLifetime;
+		}
+
+		return 2592000;
+	}
+
+	/**
+	 * Acquires a lock key, adapters with an atomic "add" operation override it
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		if this->{"get"}(lockKey, lifetime) !== null {
+			return false;
+		}
+
+		return this->_saveSilently(lockKey, 1, lifetime);
+	}
+
+	/**
+	 * Returns a backend option or its default value
+	 */
+	protected function _getOption(string! name, var defaultValue)
+	{
+		var value;
+
+		if fetch value, this->_options[name] {
+			return value;
+		}
+
+		return defaultValue;
+	}
 }
@@ -210,6 +210,134 @@ class Apc extends Backend
 		return apc_delete("_PHCA" . this->_prefix . keyName);
 	}
 
+	/**
+	 * Returns the cached contents of several keys with a single apc_fetch
+	 *
+	 *<code>
+	 * $contents = $cache->getMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function getMany(array! keys, lifetime = null) -> array
+	{
+		var frontend, prefix, keyName, prefixedKeys, cachedContents, cachedContent, contents;
+
+		let contents = [];
+
+		if !count(keys) {
+			return contents;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = "_PHCA" . prefix . keyName;
+		}
+
+		let cachedContents = apc_fetch(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		for keyName in keys {
+			if fetch cachedContent, cachedContents["_PHCA" . prefix . keyName] {
+				let contents[keyName] = frontend->afterRetrieve(cachedContent);
+			} else {
+				let contents[keyName] = null;
+			}
+		}
+
+		return contents;
+	}
+
+	/**
+	 * Stores several contents indexed by key with a single apc_store
+	 *
+	 *<code>
+	 * $cache->saveMany(
+	 *     [
+	 *         "my-key"       => $data,
+	 *         "my-other-key" => $otherData,
+	 *     ],
+	 *     3600
+	 * );
+	 *</code>
+	 */
+	public function saveMany(array! items, lifetime = null) -> boolean
+	{
+		var frontend, prefix, keyName, content, preparedItems, ttl, failed;
+
+		if !count(items) {
+			return true;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			preparedItems = [];
+
+		for keyName, content in items {
+			if !is_numeric(content) {
+				let preparedItems["_PHCA" . prefix . keyName] = frontend->beforeStore(content);
+			} else {
+				let preparedItems["_PHCA" . prefix . keyName] = content;
+			}
+		}
+
+		/**
+		 * Take the lifetime from the frontend or read it from the set in start()
+		 */
+		if lifetime === null {
+			let ttl = this->_lastLifetime;
+			if ttl === null {
+				let ttl = frontend->getLifetime();
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		/**
+		 * apc_store returns the keys that couldn't be stored
+		 */
+		let failed = apc_store(preparedItems, null, ttl);
+
+		if typeof failed != "array" || count(failed) {
+			throw new Exception("Failed storing data in apc");
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys with a single apc_delete
+	 *
+	 *<code>
+	 * $cache->deleteMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function deleteMany(array! keys) -> boolean
+	{
+		var prefix, keyName, prefixedKeys, failed;
+
+		if !count(keys) {
+			return true;
+		}
+
+		let prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = "_PHCA" . prefix . keyName;
+		}
+
+		/**
+		 * apc_delete returns the keys that couldn't be deleted
+		 */
+		let failed = apc_delete(prefixedKeys);
+
+		return typeof failed == "array" && !count(failed);
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
@@ -291,4 +419,12 @@ class Apc extends Backend
 
 		return true;
 	}
+
+	/**
+	 * Acquires a lock key with an atomic apc_add
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		return (bool) apc_add("_PHCA" . this->_prefix . lockKey, 1, lifetime);
+	}
 }
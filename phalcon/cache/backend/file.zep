@@ -58,9 +58,31 @@ use Phalcon\Cache\FrontendInterface;
  *     echo $content;
  * }
  *</code>
+ *
+ * With the "sharding" option the files are spread in two levels of
+ * directories named after the hash of the key, written atomically and
+ * prefixed with a header holding their expiration time:
+ *
+ *<code>
+ * $cache = new File(
+ *     $frontCache,
+ *     [
+ *         "cacheDir" => "../app/cache/",
+ *         "sharding" => true,
+ *     ]
+ * );
+ *
+ * // Remove up to 1000 expired entries, resuming where the last call stopped
+ * $cache->gc(1000);
+ *</code>
  */
 class File extends Backend
 {
+	/**
+	 * Length of the header of the sharded files: creation and expiration times
+	 */
+	const HEADER_LENGTH = 20;
+
 	/**
 	 * Default to false for backwards compatibility
 	 *
@@ -68,17 +90,28 @@ class File extends Backend
 	 */
 	private _useSafeKey = false;
 
+	/**
+	 * Whether the files are stored in hash sharded directories
+	 *
+	 * @var boolean
+	 */
+	protected _sharding = false;
+
 	/**
 	 * Phalcon\Cache\Backend\File constructor
 	 */
 	public function __construct(<FrontendInterface> frontend, array options)
 	{
-		var prefix, safekey;
+		var prefix, safekey, sharding;
 
 		if !isset options["cacheDir"] {
 			throw new Exception("Cache directory must be specified with the option cacheDir");
 		}
 
+		if fetch sharding, options["sharding"] {
+			let this->_sharding = (bool) sharding;
+		}
+
 		if fetch safekey, options["safekey"] {
 			if typeof safekey !== "boolean" {
 				throw new Exception("safekey option should be a boolean.");
@@ -102,11 +135,28 @@ class File extends Backend
 	 */
 	public function get(string keyName, int lifetime = null) -> var | null
 	{
-		var prefixedKey, cacheDir, cacheFile, frontend, lastLifetime, ttl, cachedContent, ret, modifiedTime;
+		var prefixedKey, cacheDir, cacheFile, frontend, lastLifetime, ttl, cachedContent, ret, modifiedTime, entry;
 
 		let prefixedKey =  this->_prefix . this->getKey(keyName);
 		let this->_lastKey = prefixedKey;
 
+		/**
+		 * Sharded files carry their expiration, they are read without a stat
+		 */
+		if this->_sharding {
+			let entry = this->_readEntry(this->_getCacheFile(prefixedKey), lifetime);
+			if entry === null {
+				return null;
+			}
+
+			let cachedContent = entry[2];
+			if is_numeric(cachedContent) {
+				return cachedContent;
+			}
+
+			return this->_frontend->afterRetrieve(cachedContent);
+		}
+
 		if !fetch cacheDir, this->_options["cacheDir"] {
 			throw new Exception("Unexpected inconsistency in options");
 		}
@@ -173,7 +223,7 @@ class File extends Backend
 	 */
 	public function save(var keyName = null, var content = null, lifetime = null, boolean stopBuffer = true) -> boolean
 	{
-		var lastKey, frontend, cacheDir, isBuffering, cacheFile, cachedContent, preparedContent, status;
+		var lastKey, frontend, cacheDir, isBuffering, cacheFile, cachedContent, preparedContent, status, ttl, expires;
 
 		if keyName === null {
 			let lastKey = this->_lastKey;
@@ -192,7 +242,7 @@ class File extends Backend
 			throw new Exception("Unexpected inconsistency in options");
 		}
 
-		let cacheFile = cacheDir . lastKey;
+		let cacheFile = this->_getCacheFile(lastKey);
 
 		if content === null {
 			let cachedContent = frontend->getContent();
@@ -207,14 +257,29 @@ class File extends Backend
 		}
 
 		/**
-		 * We use file_put_contents to respect open-base-dir directive
+		 * Sharded files store their expiration in the header
 		 */
-		let status = file_put_contents(cacheFile, preparedContent);
+		if this->_sharding {
+			if lifetime === null {
+				let ttl = this->_lastLifetime;
+				if !ttl {
+					let ttl = frontend->getLifetime();
+				}
+			} else {
+				let ttl = lifetime;
+			}
 
-		if status === false {
-			throw new Exception("Cache file ". cacheFile . " could not be written");
+			if ttl >= 1 {
+				let expires = time() + ttl;
+			} else {
+				let expires = 0;
+			}
+
+			let preparedContent = this->_getHeader(time(), expires) . preparedContent;
 		}
 
+		let status = this->_writeFile(cacheFile, preparedContent);
+
 		let isBuffering = frontend->isBuffering();
 
 		if stopBuffer === true {
@@ -243,7 +308,7 @@ class File extends Backend
 			throw new Exception("Unexpected inconsistency in options");
 		}
 
-		let cacheFile = cacheDir . this->_prefix . this->getKey(keyName);
+		let cacheFile = this->_getCacheFile(this->_prefix . this->getKey(keyName));
 		if file_exists(cacheFile) {
 			return unlink(cacheFile);
 		}
@@ -263,7 +328,7 @@ class File extends Backend
 	 */
 	public function queryKeys(string prefix = null) -> array
 	{
-		var item, key, cacheDir, prefixedKey;
+		var item, key, cacheDir, prefixedKey, shard;
 		array keys = [];
 
 		if !fetch cacheDir, this->_options["cacheDir"] {
@@ -274,12 +339,31 @@ class File extends Backend
 			let prefixedKey = this->_prefix . this->getKey(prefix);
 		}
 
+		if this->_sharding {
+			for shard in this->_getShards() {
+				for key in this->_getShardKeys(shard) {
+					if empty prefix || starts_with(key, prefixedKey) {
+						let keys[] = key;
+					}
+				}
+			}
+			return keys;
+		}
+
 		/**
 		 * We use a directory iterator to traverse the cache dir directory
 		 */
 		for item in iterator(new \DirectoryIterator(cacheDir)) {
 			if likely item->isDir() === false {
 				let key = item->getFileName();
+
+				/**
+				 * Temporary files of writes in progress
+				 */
+				if starts_with(key, ".") {
+					continue;
+				}
+
 				if !empty prefix {
 					if starts_with(key, prefixedKey) {
 						let keys[] = key;
@@ -310,6 +394,10 @@ class File extends Backend
 			let lastKey = prefix . this->getKey(keyName);
 		}
 
+		if lastKey && this->_sharding {
+			return this->_readEntry(this->_getCacheFile(lastKey), lifetime, true) !== null;
+		}
+
 		if lastKey {
 
 			let cacheFile = this->_options["cacheDir"] . lastKey;
@@ -348,8 +436,13 @@ class File extends Backend
 			cachedContent, result, modifiedTime;
 
 		let prefixedKey = this->_prefix . this->getKey(keyName),
-			this->_lastKey = prefixedKey,
-			cacheFile = this->_options["cacheDir"] . prefixedKey;
+			this->_lastKey = prefixedKey;
+
+		if this->_sharding {
+			return this->_updateCounter(prefixedKey, value);
+		}
+
+		let cacheFile = this->_options["cacheDir"] . prefixedKey;
 
 		if file_exists(cacheFile) {
 
@@ -386,9 +479,7 @@ class File extends Backend
 				if is_numeric(cachedContent) {
 
 					let result = cachedContent + value;
-					if file_put_contents(cacheFile, result) === false {
-						throw new Exception("Cache directory could not be written");
-					}
+					this->_writeFile(cacheFile, result);
 
 					return result;
 				}
@@ -408,8 +499,13 @@ class File extends Backend
 		var prefixedKey, cacheFile, lifetime, ttl, cachedContent, result, modifiedTime;
 
 		let prefixedKey = this->_prefix . this->getKey(keyName),
-			this->_lastKey = prefixedKey,
-			cacheFile = this->_options["cacheDir"] . prefixedKey;
+			this->_lastKey = prefixedKey;
+
+		if this->_sharding {
+			return this->_updateCounter(prefixedKey, -value);
+		}
+
+		let cacheFile = this->_options["cacheDir"] . prefixedKey;
 
 		if file_exists(cacheFile) {
 
@@ -444,9 +540,7 @@ class File extends Backend
 				if is_numeric(cachedContent) {
 
 					let result = cachedContent - value;
-					if file_put_contents(cacheFile, result) === false {
-						throw new Exception("Cache directory can't be written");
-					}
+					this->_writeFile(cacheFile, result);
 
 					return result;
 				}
@@ -461,7 +555,7 @@ class File extends Backend
 	 */
 	public function flush() -> boolean
 	{
-		var prefix, cacheDir, item, key, cacheFile;
+		var prefix, cacheDir, item, key, cacheFile, shard;
 
 		let prefix = this->_prefix;
 
@@ -469,12 +563,29 @@ class File extends Backend
 			throw new Exception("Unexpected inconsistency in options");
 		}
 
+		if this->_sharding {
+			for shard in this->_getShards() {
+				for key in this->_getShardKeys(shard) {
+					if empty prefix || starts_with(key, prefix) {
+						if !unlink(shard . key) {
+							return false;
+						}
+					}
+				}
+			}
+			return true;
+		}
+
 		for item in iterator(new \DirectoryIterator(cacheDir)) {
 
 			if likely item->isFile() == true {
 				let key = item->getFileName(),
 					cacheFile = item->getPathName();
 
+				if starts_with(key, ".") {
+					continue;
+				}
+
 				if empty prefix || starts_with(key, prefix) {
 					if  !unlink(cacheFile) {
 						return false;
@@ -486,6 +597,66 @@ class File extends Backend
 		return true;
 	}
 
+	/**
+	 * Removes the expired entries of up to "limit" files, resuming from the
+	 * shard where the previous call stopped. Returns the number of entries removed.
+	 * Without the "sharding" option the files don't store their expiration, so
+	 * only the temporary files left by interrupted writes are removed
+	 *
+	 *<code>
+	 * $cache->gc(1000);
+	 *</code>
+	 */
+	public function gc(int limit = 1000) -> int
+	{
+		var cacheDir, stateFile, hash, shard, key, file;
+		int position = 0, visited = 0, examined = 0, removed = 0;
+
+		if !fetch cacheDir, this->_options["cacheDir"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if !this->_sharding {
+			this->_removeTemporaryFiles(cacheDir);
+			return 0;
+		}
+
+		let stateFile = cacheDir . ".gc";
+		if file_exists(stateFile) {
+			let position = (int) file_get_contents(stateFile) % 65536;
+		}
+
+		while examined < limit && visited < 65536 {
+
+			let hash = sprintf("%04x", position),
+				shard = cacheDir . substr(hash, 0, 2) . DIRECTORY_SEPARATOR . substr(hash, 2, 2) . DIRECTORY_SEPARATOR;
+
+			let position = (position + 1) % 65536,
+				visited++,
+				examined++;
+
+			if !is_dir(shard) {
+				continue;
+			}
+
+			for key in this->_getShardKeys(shard) {
+				let examined++,
+					file = shard . key;
+				if this->_readEntry(file, null, true) === null {
+					if unlink(file) {
+						let removed++;
+					}
+				}
+			}
+
+			this->_removeTemporaryFiles(shard);
+		}
+
+		file_put_contents(stateFile, position);
+
+		return removed;
+	}
+
 	/**
 	 * Return a file-system safe identifier for a given key
 	 */
@@ -507,4 +678,202 @@ class File extends Backend
 
 		return this;
 	}
+
+	/**
+	 * Returns the path of the file storing a prefixed key
+	 */
+	protected function _getCacheFile(string! lastKey) -> string
+	{
+		var cacheDir, hash;
+
+		if !fetch cacheDir, this->_options["cacheDir"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if !this->_sharding {
+			return cacheDir . lastKey;
+		}
+
+		let hash = md5(lastKey);
+
+		return cacheDir . substr(hash, 0, 2) . DIRECTORY_SEPARATOR . substr(hash, 2, 2) . DIRECTORY_SEPARATOR . lastKey;
+	}
+
+	/**
+	 * Returns the header of a sharded file
+	 */
+	protected function _getHeader(int created, int expires) -> string
+	{
+		return sprintf("%010d%010d", created, expires);
+	}
+
+	/**
+	 * Reads a sharded file returning its creation time, expiration time and
+	 * content, or null if it doesn't exist or has expired
+	 */
+	protected function _readEntry(string! cacheFile, lifetime = null, boolean headerOnly = false) -> array | null
+	{
+		var data, header, created, expires, now;
+
+		if !file_exists(cacheFile) {
+			return null;
+		}
+
+		/**
+		 * Use file-get-contents to control that the openbase_dir can't be skipped
+		 */
+		if headerOnly {
+			let data = file_get_contents(cacheFile, false, null, 0, self::HEADER_LENGTH);
+		} else {
+			let data = file_get_contents(cacheFile);
+		}
+
+		if typeof data != "string" || strlen(data) < self::HEADER_LENGTH {
+			return null;
+		}
+
+		let header = substr(data, 0, self::HEADER_LENGTH);
+		if !ctype_digit(header) {
+			return null;
+		}
+
+		let created = (int) substr(header, 0, 10),
+			expires = (int) substr(header, 10),
+			now = time();
+
+		if expires && expires <= now {
+			return null;
+		}
+
+		if lifetime && created + lifetime <= now {
+			return null;
+		}
+
+		return [created, expires, (string) substr(data, self::HEADER_LENGTH)];
+	}
+
+	/**
+	 * Writes a file atomically: the content is written to a temporary file
+	 * that replaces the cache file, so readers never see a partial write
+	 */
+	protected function _writeFile(string! cacheFile, var data) -> int
+	{
+		var directory, temporary, status;
+
+		let directory = dirname(cacheFile);
+
+		if this->_sharding && !is_dir(directory) {
+			/**
+			 * 0777 reduced by the umask
+			 */
+			if !mkdir(directory, 0x1FF, true) && !is_dir(directory) {
+				throw new Exception("Cache directory " . directory . " could not be created");
+			}
+		}
+
+		let temporary = directory . DIRECTORY_SEPARATOR . "." . basename(cacheFile) . "." . uniqid("", true);
+
+		/**
+		 * We use file_put_contents to respect open-base-dir directive
+		 */
+		let status = file_put_contents(temporary, data);
+
+		if status === false {
+			throw new Exception("Cache file ". cacheFile . " could not be written");
+		}
+
+		if !rename(temporary, cacheFile) {
+			unlink(temporary);
+			throw new Exception("Cache file ". cacheFile . " could not be written");
+		}
+
+		return status;
+	}
+
+	/**
+	 * Removes the temporary files left in a directory by writes interrupted more than an hour ago
+	 */
+	protected function _removeTemporaryFiles(string! directory) -> void
+	{
+		var files, file, expired;
+
+		let files = glob(directory . ".*");
+		if typeof files != "array" {
+			return;
+		}
+
+		let expired = time() - 3600;
+
+		for file in files {
+			if basename(file) === ".gc" {
+				continue;
+			}
+			if is_file(file) && filemtime(file) < expired {
+				unlink(file);
+			}
+		}
+	}
+
+	/**
+	 * Adds a value to a numeric sharded entry keeping its expiration
+	 */
+	protected function _updateCounter(string! prefixedKey, int value) -> int | null
+	{
+		var cacheFile, entry, result;
+
+		let cacheFile = this->_getCacheFile(prefixedKey),
+			entry = this->_readEntry(cacheFile);
+
+		if entry === null || !is_numeric(entry[2]) {
+			return null;
+		}
+
+		let result = entry[2] + value;
+
+		this->_writeFile(cacheFile, this->_getHeader(entry[0], entry[1]) . result);
+
+		return result;
+	}
+
+	/**
+	 * Returns the existing second level shard directories
+	 */
+	protected function _getShards() -> array
+	{
+		var cacheDir, shards, shard, directories;
+
+		if !fetch cacheDir, this->_options["cacheDir"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let shards = [],
+			directories = glob(cacheDir . "[0-9a-f][0-9a-f]" . DIRECTORY_SEPARATOR . "[0-9a-f][0-9a-f]", GLOB_ONLYDIR);
+
+		if typeof directories == "array" {
+			for shard in directories {
+				let shards[] = shard . DIRECTORY_SEPARATOR;
+			}
+		}
+
+		return shards;
+	}
+
+	/**
+	 * Returns the keys stored in a shard directory
+	 */
+	protected function _getShardKeys(string! shard) -> array
+	{
+		var keys, file, files;
+
+		let keys = [],
+			files = glob(shard . "*");
+
+		if typeof files == "array" {
+			for file in files {
+				let keys[] = basename(file);
+			}
+		}
+
+		return keys;
+	}
 }
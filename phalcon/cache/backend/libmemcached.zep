@@ -314,6 +314,209 @@ class Libmemcached extends Backend
 		return ret;
 	}
 
+	/**
+	 * Returns the cached contents of several keys with a single getMulti
+	 *
+	 *<code>
+	 * $contents = $cache->getMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function getMany(array! keys, lifetime = null) -> array
+	{
+		var memcache, frontend, prefix, keyName, prefixedKeys, cachedContents, cachedContent, contents;
+
+		let contents = [];
+
+		if !count(keys) {
+			return contents;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let cachedContents = memcache->getMulti(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		for keyName in keys {
+			if !fetch cachedContent, cachedContents[prefix . keyName] {
+				let contents[keyName] = null;
+				continue;
+			}
+
+			if !cachedContent {
+				let contents[keyName] = null;
+			} elseif is_numeric(cachedContent) {
+				let contents[keyName] = cachedContent;
+			} else {
+				let contents[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return contents;
+	}
+
+	/**
+	 * Stores several contents indexed by key with a single setMulti
+	 *
+	 *<code>
+	 * $cache->saveMany(
+	 *     [
+	 *         "my-key"       => $data,
+	 *         "my-other-key" => $otherData,
+	 *     ],
+	 *     3600
+	 * );
+	 *</code>
+	 */
+	public function saveMany(array! items, lifetime = null) -> boolean
+	{
+		var memcache, frontend, prefix, keyName, content, preparedItems, tmp, tt1,
+			success, options, specialKey, keys, lastKey;
+		boolean changed = false;
+
+		if !count(items) {
+			return true;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			preparedItems = [];
+
+		for keyName, content in items {
+			if !is_numeric(content) {
+				let preparedItems[prefix . keyName] = frontend->beforeStore(content);
+			} else {
+				let preparedItems[prefix . keyName] = content;
+			}
+		}
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let tt1 = frontend->getLifetime();
+			} else {
+				let tt1 = tmp;
+			}
+		} else {
+			let tt1 = lifetime;
+		}
+
+		let success = memcache->setMulti(preparedItems, tt1);
+
+		if !success {
+			throw new Exception("Failed storing data in memcached, error code: " . memcache->getResultCode());
+		}
+
+		let options = this->_options;
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if specialKey != "" {
+			/**
+			 * Update the stats key once for all the keys
+			 */
+			let keys = memcache->get(specialKey);
+			if typeof keys != "array" {
+				let keys = [];
+			}
+
+			for lastKey, content in preparedItems {
+				if !isset keys[lastKey] {
+					let keys[lastKey] = tt1,
+						changed = true;
+				}
+			}
+
+			if changed {
+				memcache->set(specialKey, keys);
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * Deletes several keys with a single deleteMulti
+	 *
+	 *<code>
+	 * $cache->deleteMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function deleteMany(array! keys) -> boolean
+	{
+		var memcache, prefix, keyName, prefixedKey, prefixedKeys, options, specialKey, storedKeys, results, result;
+
+		if !count(keys) {
+			return true;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let prefix = this->_prefix,
+			options = this->_options,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if specialKey != "" {
+			let storedKeys = memcache->get(specialKey);
+			if typeof storedKeys == "array" {
+				for prefixedKey in prefixedKeys {
+					unset storedKeys[prefixedKey];
+				}
+				memcache->set(specialKey, storedKeys);
+			}
+		}
+
+		/**
+		 * Delete the keys from memcached
+		 */
+		let results = memcache->deleteMulti(prefixedKeys);
+		if typeof results != "array" {
+			return false;
+		}
+
+		for result in results {
+			if result !== true {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
@@ -510,4 +713,20 @@ class Libmemcached extends Backend
 
 		return true;
 	}
+
+	/**
+	 * Acquires a lock key with an atomic add
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		var memcache;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		return (bool) memcache->add(this->_prefix . lockKey, 1, lifetime);
+	}
 }
@@ -0,0 +1,494 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Cache\Backend;
+
+use Phalcon\Cache\Backend;
+use Phalcon\Cache\Exception;
+use Phalcon\Cache\FrontendInterface;
+
+/**
+ * Phalcon\Cache\Backend\Lru
+ *
+ * Stores content in a size-bounded in-process memory. The least recently used
+ * entries are evicted when the limit is reached and every entry expires with
+ * its own lifetime. It is intended to be used as the first tier of
+ * Phalcon\Cache\Multiple in long running processes, where it can also
+ * remember the keys missing in the remote backends (negative caching)
+ *
+ *<code>
+ * use Phalcon\Cache\Multiple;
+ * use Phalcon\Cache\Backend\Lru;
+ * use Phalcon\Cache\Backend\Redis;
+ * use Phalcon\Cache\Frontend\None as FrontNone;
+ * use Phalcon\Cache\Frontend\Data as FrontData;
+ *
+ * $lru = new Lru(
+ *     new FrontNone(
+ *         [
+ *             "lifetime" => 60,
+ *         ]
+ *     ),
+ *     [
+ *         "size"             => 500,
+ *         "negativeLifetime" => 10,
+ *         "exclude"          => ["session-", "rate-limit-"],
+ *     ]
+ * );
+ *
+ * $cache = new Multiple(
+ *     [
+ *         $lru,
+ *         new Redis(
+ *             new FrontData(
+ *                 [
+ *                     "lifetime" => 3600,
+ *                 ]
+ *             )
+ *         ),
+ *     ]
+ * );
+ *
+ * $data = $cache->get("my-data");
+ *
+ * echo $lru->getHitRatio();
+ *</code>
+ */
+class Lru extends Backend
+{
+	/**
+	 * Entries indexed by key in least to most recently used order: [expiration, content]
+	 */
+	protected _data = [];
+
+	protected _size = 1000;
+
+	protected _negativeLifetime = 0;
+
+	/**
+	 * Prefixes of the keys that are never stored
+	 */
+	protected _exclude = [];
+
+	protected _hits = 0;
+
+	protected _misses = 0;
+
+	protected _negativeHits = 0;
+
+	protected _evictions = 0;
+
+	/**
+	 * Phalcon\Cache\Backend\Lru constructor
+	 *
+	 * @param \Phalcon\Cache\FrontendInterface frontend
+	 * @param array options
+	 */
+	public function __construct(<FrontendInterface> frontend, options = null)
+	{
+		var size, negativeLifetime, exclude;
+
+		if typeof options == "array" {
+
+			if fetch size, options["size"] {
+				if size < 1 {
+					throw new Exception("The size of the LRU cache must be greater than zero");
+				}
+				let this->_size = (int) size;
+			}
+
+			if fetch negativeLifetime, options["negativeLifetime"] {
+				let this->_negativeLifetime = (int) negativeLifetime;
+			}
+
+			if fetch exclude, options["exclude"] {
+				if typeof exclude != "array" {
+					throw new Exception("The excluded keys must be an array of prefixes");
+				}
+				let this->_exclude = exclude;
+			}
+		}
+
+		parent::__construct(frontend, options);
+	}
+
+	/**
+	 * Returns a cached content
+	 */
+	public function get(string keyName, int lifetime = null) -> var | null
+	{
+		var lastKey, entry, cachedContent;
+
+		let lastKey = this->_prefix . keyName,
+			this->_lastKey = lastKey;
+
+		if !fetch entry, this->_data[lastKey] {
+			let this->_misses++;
+			return null;
+		}
+
+		if entry[0] && entry[0] <= time() {
+			unset this->_data[lastKey];
+			let this->_misses++;
+			return null;
+		}
+
+		/**
+		 * The entry becomes the most recently used
+		 */
+		unset this->_data[lastKey];
+		let this->_data[lastKey] = entry;
+
+		let cachedContent = entry[1];
+
+		if cachedContent === null {
+			let this->_negativeHits++;
+			return null;
+		}
+
+		let this->_hits++;
+
+		if is_numeric(cachedContent) {
+			return cachedContent;
+		}
+
+		return this->_frontend->afterRetrieve(cachedContent);
+	}
+
+	/**
+	 * Stores cached content into the memory and stops the frontend
+	 *
+	 * @param string keyName
+	 * @param string content
+	 * @param int lifetime
+	 * @param boolean stopBuffer
+	 */
+	public function save(var keyName = null, var content = null, lifetime = null, boolean stopBuffer = true) -> boolean
+	{
+		var lastKey, frontend, cachedContent, preparedContent, isBuffering, ttl;
+
+		if keyName === null {
+			let lastKey = this->_lastKey;
+		} else {
+			let lastKey = this->_prefix . keyName,
+				this->_lastKey = lastKey;
+		}
+
+		if !lastKey {
+			throw new Exception("Cache must be started first");
+		}
+
+		let frontend = this->_frontend;
+
+		if content === null {
+			let cachedContent = frontend->getContent();
+		} else {
+			let cachedContent = content;
+		}
+
+		if !this->isExcluded(lastKey) {
+
+			if !is_numeric(cachedContent) {
+				let preparedContent = frontend->beforeStore(cachedContent);
+			} else {
+				let preparedContent = cachedContent;
+			}
+
+			if lifetime === null {
+				let ttl = this->_lastLifetime;
+				if !ttl {
+					let ttl = frontend->getLifetime();
+				}
+			} else {
+				let ttl = lifetime;
+			}
+
+			this->_store(lastKey, preparedContent, ttl);
+		}
+
+		let isBuffering = frontend->isBuffering();
+
+		if stopBuffer === true {
+			frontend->stop();
+		}
+
+		if isBuffering === true {
+			echo cachedContent;
+		}
+
+		let this->_started = false;
+
+		return true;
+	}
+
+	/**
+	 * Remembers that a key is missing, get() returns null for it without
+	 * asking the next tiers until the "negativeLifetime" expires
+	 */
+	public function saveNegative(var keyName, lifetime = null) -> boolean
+	{
+		var lastKey;
+
+		if lifetime === null {
+			let lifetime = this->_negativeLifetime;
+		}
+
+		if lifetime < 1 {
+			return false;
+		}
+
+		let lastKey = this->_prefix . keyName;
+
+		if this->isExcluded(lastKey) {
+			return false;
+		}
+
+		this->_store(lastKey, null, lifetime);
+
+		return true;
+	}
+
+	/**
+	 * Checks whether a key is known to be missing
+	 */
+	public function isNegative(var keyName) -> boolean
+	{
+		var entry;
+
+		if !fetch entry, this->_data[this->_prefix . keyName] {
+			return false;
+		}
+
+		if entry[0] && entry[0] <= time() {
+			return false;
+		}
+
+		return entry[1] === null;
+	}
+
+	/**
+	 * Checks whether a prefixed key is excluded from the cache
+	 */
+	public function isExcluded(string! lastKey) -> boolean
+	{
+		var prefix;
+
+		for prefix in this->_exclude {
+			if starts_with(lastKey, this->_prefix . prefix) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Deletes a value from the cache by its key
+	 *
+	 * @param string keyName
+	 */
+	public function delete(var keyName) -> boolean
+	{
+		var lastKey;
+
+		let lastKey = this->_prefix . keyName;
+
+		if isset this->_data[lastKey] {
+			unset this->_data[lastKey];
+			return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Query the existing cached keys.
+	 *
+	 * <code>
+	 * $cache->save("users-ids", [1, 2, 3]);
+	 * $cache->save("projects-ids", [4, 5, 6]);
+	 *
+	 * var_dump($cache->queryKeys("users")); // ["users-ids"]
+	 * </code>
+	 */
+	public function queryKeys(string prefix = null) -> array
+	{
+		var keys, key, entry, now;
+
+		let keys = [],
+			now = time();
+
+		for key, entry in this->_data {
+			if entry[1] === null || (entry[0] && entry[0] <= now) {
+				continue;
+			}
+			if !empty prefix && !starts_with(key, prefix) {
+				continue;
+			}
+			let keys[] = key;
+		}
+
+		return keys;
+	}
+
+	/**
+	 * Checks if cache exists and it hasn't expired
+	 *
+	 * @param string|int keyName
+	 * @param int lifetime
+	 */
+	public function exists(var keyName = null, lifetime = null) -> boolean
+	{
+		var lastKey, entry;
+
+		if keyName === null {
+			let lastKey = this->_lastKey;
+		} else {
+			let lastKey = this->_prefix . keyName;
+		}
+
+		if !fetch entry, this->_data[lastKey] {
+			return false;
+		}
+
+		if entry[0] && entry[0] <= time() {
+			return false;
+		}
+
+		return entry[1] !== null;
+	}
+
+	/**
+	 * Increment of given $keyName by $value
+	 *
+	 * @param string keyName
+	 */
+	public function increment(keyName = null, int value = 1) -> int | null
+	{
+		var lastKey, entry, result;
+
+		if !keyName {
+			let lastKey = this->_lastKey;
+		} else {
+			let lastKey = this->_prefix . keyName,
+				this->_lastKey = lastKey;
+		}
+
+		if !fetch entry, this->_data[lastKey] {
+			return null;
+		}
+
+		if !is_numeric(entry[1]) || (entry[0] && entry[0] <= time()) {
+			return null;
+		}
+
+		let result = entry[1] + value,
+			this->_data[lastKey] = [entry[0], result];
+
+		return result;
+	}
+
+	/**
+	 * Decrement of $keyName by given $value
+	 *
+	 * @param string keyName
+	 */
+	public function decrement(keyName = null, int value = 1) -> int | null
+	{
+		return this->increment(keyName, -value);
+	}
+
+	/**
+	 * Immediately invalidates all existing items.
+	 */
+	public function flush() -> boolean
+	{
+		let this->_data = [];
+		return true;
+	}
+
+	/**
+	 * Returns the ratio of lookups served by the cache, negative hits included
+	 */
+	public function getHitRatio() -> double
+	{
+		var total;
+
+		let total = this->_hits + this->_negativeHits + this->_misses;
+		if !total {
+			return 0.0;
+		}
+
+		return (this->_hits + this->_negativeHits) / total;
+	}
+
+	/**
+	 * Returns the counters of the cache
+	 */
+	public function getStats() -> array
+	{
+		return [
+			"hits":         this->_hits,
+			"negativeHits": this->_negativeHits,
+			"misses":       this->_misses,
+			"evictions":    this->_evictions,
+			"entries":      count(this->_data),
+			"size":         this->_size,
+			"hitRatio":     this->getHitRatio()
+		];
+	}
+
+	/**
+	 * Resets the counters of the cache
+	 */
+	public function resetStats() -> void
+	{
+		let this->_hits = 0,
+			this->_negativeHits = 0,
+			this->_misses = 0,
+			this->_evictions = 0;
+	}
+
+	/**
+	 * Stores an entry as the most recently used, evicting the least recently used if the cache is full
+	 */
+	protected function _store(string! lastKey, var content, var lifetime) -> void
+	{
+		var key, entry;
+
+		if isset this->_data[lastKey] {
+			unset this->_data[lastKey];
+		} elseif count(this->_data) >= this->_size {
+			/**
+			 * The least recently used entry is the first one, it is found
+			 * without iterating the entries being modified
+			 */
+			for key, entry in array_slice(this->_data, 0, 1, true) {
+				unset this->_data[key];
+				let this->_evictions++;
+			}
+		}
+
+		if lifetime >= 1 {
+			let this->_data[lastKey] = [time() + lifetime, content];
+		} else {
+			let this->_data[lastKey] = [0, content];
+		}
+	}
+}
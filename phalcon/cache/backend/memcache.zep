@@ -316,6 +316,63 @@ class Memcache extends Backend
 		return ret;
 	}
 
+	/**
+	 * Returns the cached contents of several keys with a single get
+	 *
+	 *<code>
+	 * $contents = $cache->getMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function getMany(array! keys, lifetime = null) -> array
+	{
+		var memcache, frontend, prefix, keyName, prefixedKeys, cachedContents, cachedContent, contents;
+
+		let contents = [];
+
+		if !count(keys) {
+			return contents;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		/**
+		 * Memcache::get accepts an array of keys and returns the ones found
+		 */
+		let cachedContents = memcache->get(prefixedKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		for keyName in keys {
+			if !fetch cachedContent, cachedContents[prefix . keyName] {
+				let contents[keyName] = null;
+				continue;
+			}
+
+			if cachedContent === false {
+				let contents[keyName] = null;
+			} elseif is_numeric(cachedContent) {
+				let contents[keyName] = cachedContent;
+			} else {
+				let contents[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return contents;
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
@@ -494,4 +551,19 @@ class Memcache extends Backend
 		return true;
 	}
 
+	/**
+	 * Acquires a lock key with an atomic add
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		var memcache;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		return (bool) memcache->add(this->_prefix . lockKey, 1, 0, lifetime);
+	}
 }
@@ -30,6 +30,9 @@ use Phalcon\Cache\FrontendInterface;
  *
  * This adapter uses the special redis key "_PHCR" to store all the keys internally used by the adapter
  *
+ * In lean mode ("lean" => true) the cached keys aren't tracked in the "statsKey" set, queryKeys()
+ * and flush() iterate the keyspace with SCAN instead
+ *
  *<code>
  * use Phalcon\Cache\Backend\Redis;
  * use Phalcon\Cache\Frontend\Data as FrontData;
@@ -97,6 +100,17 @@ class Redis extends Backend
 			let options["statsKey"] = "";
 		}
 
+		if !isset options["lean"] {
+			let options["lean"] = false;
+		}
+
+		/**
+		 * Lean mode never tracks the cached keys, they are found with SCAN
+		 */
+		if options["lean"] {
+			let options["statsKey"] = "";
+		}
+
 		parent::__construct(frontend, options);
 	}
 
@@ -244,17 +258,20 @@ class Redis extends Backend
 			let tt1 = lifetime;
 		}
 
-		let success = redis->set(lastKey, preparedContent);
+		/**
+		 * The expiration is sent with the value (SET key value EX ttl)
+		 * Don't set expiration for negative ttl or zero
+		 */
+		if tt1 >= 1 {
+			let success = redis->set(lastKey, preparedContent, tt1);
+		} else {
+			let success = redis->set(lastKey, preparedContent);
+		}
 
 		if !success {
 			throw new Exception("Failed storing the data in redis");
 		}
 
-		// Don't set expiration for negative ttl or zero
-		if tt1 >= 1 {
-			redis->settimeout(lastKey, tt1);
-		}
-
 		let options = this->_options;
 
 		if !fetch specialKey, options["statsKey"] {
@@ -314,6 +331,199 @@ class Redis extends Backend
 		return (bool) redis->delete(lastKey);
 	}
 
+	/**
+	 * Returns the cached contents of several keys with a single MGET
+	 *
+	 *<code>
+	 * $contents = $cache->getMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function getMany(array! keys, lifetime = null) -> array
+	{
+		var redis, frontend, prefix, keyName, lastKeys, cachedContents, cachedContent, position, contents;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let keys = array_values(keys),
+			contents = [];
+
+		if !count(keys) {
+			return contents;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			lastKeys = [];
+
+		for keyName in keys {
+			let lastKeys[] = "_PHCR" . prefix . keyName;
+		}
+
+		let cachedContents = redis->mGet(lastKeys);
+		if typeof cachedContents != "array" {
+			let cachedContents = [];
+		}
+
+		for position, keyName in keys {
+			if !fetch cachedContent, cachedContents[position] {
+				let contents[keyName] = null;
+				continue;
+			}
+
+			if cachedContent === false {
+				let contents[keyName] = null;
+			} elseif is_numeric(cachedContent) {
+				let contents[keyName] = cachedContent;
+			} else {
+				let contents[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return contents;
+	}
+
+	/**
+	 * Stores several contents indexed by key in a single pipeline
+	 *
+	 *<code>
+	 * $cache->saveMany(
+	 *     [
+	 *         "my-key"       => $data,
+	 *         "my-other-key" => $otherData,
+	 *     ],
+	 *     3600
+	 * );
+	 *</code>
+	 */
+	public function saveMany(array! items, lifetime = null) -> boolean
+	{
+		var redis, frontend, prefix, keyName, content, preparedContent, prefixedKey, lastKey,
+			tmp, tt1, options, specialKey, results, result;
+
+		if !count(items) {
+			return true;
+		}
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			options = this->_options;
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let tt1 = frontend->getLifetime();
+			} else {
+				let tt1 = tmp;
+			}
+		} else {
+			let tt1 = lifetime;
+		}
+
+		redis->multi(constant("Redis::PIPELINE"));
+
+		for keyName, content in items {
+
+			let prefixedKey = prefix . keyName,
+				lastKey = "_PHCR" . prefixedKey;
+
+			if !is_numeric(content) {
+				let preparedContent = frontend->beforeStore(content);
+			} else {
+				let preparedContent = content;
+			}
+
+			// Don't set expiration for negative ttl or zero
+			if tt1 >= 1 {
+				redis->set(lastKey, preparedContent, tt1);
+			} else {
+				redis->set(lastKey, preparedContent);
+			}
+
+			if specialKey != "" {
+				redis->sAdd(specialKey, prefixedKey);
+			}
+		}
+
+		let results = redis->exec();
+
+		if typeof results != "array" {
+			throw new Exception("Failed storing the data in redis");
+		}
+
+		for result in results {
+			if result === false {
+				throw new Exception("Failed storing the data in redis");
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys with a single DEL
+	 *
+	 *<code>
+	 * $cache->deleteMany(["my-key", "my-other-key"]);
+	 *</code>
+	 */
+	public function deleteMany(array! keys) -> boolean
+	{
+		var redis, prefix, keyName, prefixedKey, lastKeys, members, options, specialKey;
+
+		if !count(keys) {
+			return true;
+		}
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let prefix = this->_prefix,
+			options = this->_options,
+			lastKeys = [];
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let members = [specialKey];
+
+		for keyName in keys {
+			let prefixedKey = prefix . keyName,
+				lastKeys[] = "_PHCR" . prefixedKey,
+				members[] = prefixedKey;
+		}
+
+		/**
+		 * Remove all the keys from the special key with a single SREM
+		 */
+		if specialKey != "" {
+			call_user_func_array([redis, "sRem"], members);
+		}
+
+		/**
+		* Delete the keys from redis
+		*/
+		return redis->delete(lastKeys) == count(lastKeys);
+	}
+
 	/**
 	 * Query the existing cached keys.
 	 *
@@ -337,6 +547,14 @@ class Redis extends Backend
 
 		let options = this->_options;
 
+		if options["lean"] {
+			let keys = [];
+			for key in this->_scan("_PHCR" . this->_escapePattern((string) prefix) . "*") {
+				let keys[] = substr(key, 5);
+			}
+			return keys;
+		}
+
 		if !fetch specialKey, options["statsKey"] {
 			throw new Exception("Unexpected inconsistency in options");
 		}
@@ -393,13 +611,15 @@ class Redis extends Backend
 	}
 
 	/**
-	 * Increment of given $keyName by $value
+	 * Increment of given $keyName by $value. When a lifetime is passed the counter
+	 * and its expiration are updated in a single MULTI/EXEC transaction
 	 *
 	 * @param string keyName
+	 * @param int lifetime
 	 */
-	public function increment(keyName = null, int value = 1) -> int
+	public function increment(keyName = null, int value = 1, lifetime = null) -> int
 	{
-		var redis, prefix, lastKey;
+		var redis, prefix, lastKey, results;
 
 		let redis = this->_redis;
 
@@ -416,17 +636,32 @@ class Redis extends Backend
 			let this->_lastKey = lastKey;
 		}
 
-		return redis->incrBy(lastKey, value);
+		if lifetime === null {
+			return redis->incrBy(lastKey, value);
+		}
+
+		redis->multi(constant("Redis::MULTI"));
+		redis->incrBy(lastKey, value);
+		redis->settimeout(lastKey, lifetime);
+		let results = redis->exec();
+
+		if typeof results != "array" || !isset results[0] {
+			throw new Exception("Failed updating the counter in redis");
+		}
+
+		return results[0];
 	}
 
 	/**
-	 * Decrement of $keyName by given $value
+	 * Decrement of $keyName by given $value. When a lifetime is passed the counter
+	 * and its expiration are updated in a single MULTI/EXEC transaction
 	 *
 	 * @param string keyName
+	 * @param int lifetime
 	 */
-	public function decrement(keyName = null, int value = 1) -> int
+	public function decrement(keyName = null, int value = 1, lifetime = null) -> int
 	{
-		var redis, prefix, lastKey;
+		var redis, prefix, lastKey, results;
 
 		let redis = this->_redis;
 
@@ -443,7 +678,20 @@ class Redis extends Backend
 			let this->_lastKey = lastKey;
 		}
 
-		return redis->decrBy(lastKey, value);
+		if lifetime === null {
+			return redis->decrBy(lastKey, value);
+		}
+
+		redis->multi(constant("Redis::MULTI"));
+		redis->decrBy(lastKey, value);
+		redis->settimeout(lastKey, lifetime);
+		let results = redis->exec();
+
+		if typeof results != "array" || !isset results[0] {
+			throw new Exception("Failed updating the counter in redis");
+		}
+
+		return results[0];
 	}
 
 	/**
@@ -466,6 +714,13 @@ class Redis extends Backend
 			let redis = this->_redis;
 		}
 
+		if options["lean"] {
+			for keys in array_chunk(this->_scan("_PHCR" . this->_escapePattern(this->_prefix) . "*"), 1000) {
+				redis->delete(keys);
+			}
+			return true;
+		}
+
 		if specialKey == "" {
 			throw new Exception("Cached keys need to be enabled to use this function (options['statsKey'] == '_PHCR')!");
 		}
@@ -481,4 +736,67 @@ class Redis extends Backend
 
 		return true;
 	}
+
+	/**
+	 * Returns the keys matching a pattern iterating the keyspace with SCAN,
+	 * so large databases aren't blocked like with KEYS
+	 */
+	protected function _scan(string! pattern) -> array
+	{
+		var redis, cursor, reply, keys, found;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let cursor = "0",
+			keys = [];
+
+		loop {
+			let reply = redis->rawCommand("SCAN", cursor, "MATCH", pattern, "COUNT", 1000);
+
+			if typeof reply != "array" || !isset reply[1] {
+				throw new Exception("Failed scanning the keys in redis");
+			}
+
+			let cursor = (string) reply[0],
+				found = reply[1];
+
+			if typeof found == "array" && count(found) {
+				let keys = array_merge(keys, found);
+			}
+
+			if cursor === "0" {
+				break;
+			}
+		}
+
+		return array_values(array_unique(keys));
+	}
+
+	/**
+	 * Escapes the glob characters of a SCAN pattern
+	 */
+	protected function _escapePattern(string! pattern) -> string
+	{
+		return addcslashes(pattern, "\\*?[]");
+	}
+
+	/**
+	 * Acquires a lock key with SET NX EX
+	 */
+	protected function _acquireLock(string! lockKey, int lifetime) -> boolean
+	{
+		var redis;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		return (bool) redis->set("_PHCR" . this->_prefix . lockKey, 1, ["nx", "ex": lifetime]);
+	}
 }
@@ -119,4 +119,19 @@ interface BackendInterface
 	 * @return boolean
 	 */
 	public function exists(keyName = null, lifetime = null);
+
+	/**
+	 * Returns the cached contents of several keys, indexed by key
+	 */
+	public function getMany(array! keys, lifetime = null) -> array;
+
+	/**
+	 * Stores several contents indexed by key
+	 */
+	public function saveMany(array! items, lifetime = null) -> boolean;
+
+	/**
+	 * Deletes several keys from the cache
+	 */
+	public function deleteMany(array! keys) -> boolean;
 }
@@ -19,7 +19,9 @@
 
 namespace Phalcon\Cache;
 
+use Phalcon\Cache\Backend;
 use Phalcon\Cache\Exception;
+use Phalcon\Cache\Backend\Lru;
 use Phalcon\Cache\BackendInterface;
 
 /**
@@ -113,7 +115,10 @@ class Multiple
 	}
 
 	/**
-	 * Returns a cached content reading the internal backends
+	 * Returns a cached content reading the internal backends. The content
+	 * found is stored in the in-process backends (Phalcon\Cache\Backend\Lru)
+	 * in front of the backend that returned it, and these backends remember
+	 * the keys missing in all of them
 	 *
 	 * @param string|int keyName
 	 * @param int lifetime
@@ -121,18 +126,96 @@ class Multiple
 	 */
 	public function get(var keyName, lifetime = null)
 	{
-		var backend, content;
+		var backend, content, local, localBackend;
+
+		let local = [];
 
 		for backend in this->_backends {
 			let content = backend->get(keyName, lifetime);
 			if content != null {
+				for localBackend in local {
+					localBackend->save(keyName, content, null, false);
+				}
 				return content;
 			}
+
+			if backend instanceof Lru {
+				if backend->isNegative(keyName) {
+					return null;
+				}
+				let local[] = backend;
+			}
+		}
+
+		for localBackend in local {
+			localBackend->saveNegative(keyName);
 		}
 
 		return null;
 	}
 
+	/**
+	 * Returns the cached contents of several keys reading the internal
+	 * backends. Each backend is only asked for the keys missing in the faster ones
+	 *
+	 * @param array keys
+	 * @param int lifetime
+	 * @return array
+	 */
+	public function getMany(array! keys, lifetime = null) -> array
+	{
+		var backend, contents, missing, keyName, content, found, local, localBackend;
+
+		let contents = [],
+			missing = [],
+			local = [];
+
+		for keyName in keys {
+			let contents[keyName] = null,
+				missing[] = keyName;
+		}
+
+		for backend in this->_backends {
+			if !count(missing) {
+				break;
+			}
+
+			let keys = missing,
+				missing = [],
+				found = [];
+
+			for keyName, content in backend->getMany(keys, lifetime) {
+				if content != null {
+					let contents[keyName] = content,
+						found[keyName] = content;
+				} elseif !(backend instanceof Lru) || !backend->isNegative(keyName) {
+					let missing[] = keyName;
+				}
+			}
+
+			/**
+			 * Store the contents found in the in-process backends in front of this one
+			 */
+			if count(found) {
+				for localBackend in local {
+					localBackend->saveMany(found);
+				}
+			}
+
+			if backend instanceof Lru {
+				let local[] = backend;
+			}
+		}
+
+		for localBackend in local {
+			for keyName in missing {
+				localBackend->saveNegative(keyName);
+			}
+		}
+
+		return contents;
+	}
+
 	/**
 	 * Starts every backend
 	 *
@@ -182,6 +265,41 @@ class Multiple
 		return true;
 	}
 
+	/**
+	 * Stores several contents indexed by key into all backends
+	 *
+	 * @param array items
+	 * @param int lifetime
+	 * @return boolean
+	 */
+	public function saveMany(array! items, lifetime = null) -> boolean
+	{
+		var backend;
+
+		for backend in this->_backends {
+			backend->saveMany(items, lifetime);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys from each backend
+	 *
+	 * @param array keys
+	 * @return boolean
+	 */
+	public function deleteMany(array! keys) -> boolean
+	{
+		var backend;
+
+		for backend in this->_backends {
+			backend->deleteMany(keys);
+		}
+
+		return true;
+	}
+
 	/**
 	 * Checks if cache exists in at least one backend
 	 *
@@ -214,4 +332,49 @@ class Multiple
 
 		return true;
 	}
+
+	/**
+	 * Returns the key of a fragment tagged with the given tags. The versions
+	 * of the tags are kept in the first backend, so it must be shared by every
+	 * request and all the backends get the same key
+	 *
+	 *<code>
+	 * $key = $cache->getTaggedKey("user-profile-5", ["user:5"]);
+	 *</code>
+	 *
+	 * @param string|int keyName
+	 */
+	public function getTaggedKey(var keyName, array! tags) -> string
+	{
+		return this->_getTagsBackend()->getTaggedKey(keyName, tags);
+	}
+
+	/**
+	 * Invalidates a tag changing its version in the first backend
+	 */
+	public function invalidateTag(string! tag) -> boolean
+	{
+		return this->_getTagsBackend()->invalidateTag(tag);
+	}
+
+	/**
+	 * Returns the backend keeping the versions of the tags
+	 */
+	protected function _getTagsBackend() -> <Backend>
+	{
+		var backends, backend;
+
+		let backends = this->_backends;
+
+		if typeof backends == "array" {
+			for backend in backends {
+				if backend instanceof Backend {
+					return backend;
+				}
+				break;
+			}
+		}
+
+		throw new Exception("Tags require a Phalcon\\Cache\\Backend as the first backend");
+	}
 }
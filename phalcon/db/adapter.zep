@@ -20,6 +20,7 @@
 namespace Phalcon\Db;
 
 use Phalcon\Db;
+use Phalcon\Db\Column;
 use Phalcon\Db\ColumnInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
@@ -96,6 +97,11 @@ abstract class Adapter implements AdapterInterface, EventsAwareInterface
 	 */
 	protected _transactionsWithSavepoints = false;
 
+	/**
+	 * Maximum number of bind parameters accepted by a single statement
+	 */
+	protected _maxBindParams = 65535;
+
 	/**
 	 * Connection ID
 	 */
@@ -373,6 +379,227 @@ abstract class Adapter implements AdapterInterface, EventsAwareInterface
 		return this->{"execute"}(insertSql, insertValues, bindDataTypes);
 	}
 
+	/**
+	 * Inserts several rows into a table using multi-row INSERT statements.
+	 * The rows are split in chunks that respect the bind parameters and
+	 * statement size limits of the database system, the db:beforeQuery and
+	 * db:afterQuery events are fired once per chunk. When the rows need
+	 * several statements and no transaction is active, the chunks are inserted
+	 * in a transaction, so a failed chunk doesn't leave the previous ones inserted
+	 *
+	 * <code>
+	 * // Inserting several robots
+	 * $success = $connection->insertMany(
+	 *     "robots",
+	 *     [
+	 *         ["Astro Boy", 1952],
+	 *         ["Terminator", 2029],
+	 *     ],
+	 *     ["name", "year"]
+	 * );
+	 *
+	 * // The rows can be passed as dictionaries
+	 * $success = $connection->insertMany(
+	 *     "robots",
+	 *     [
+	 *         ["name" => "Astro Boy", "year" => 1952],
+	 *         ["name" => "Terminator", "year" => 2029],
+	 *     ]
+	 * );
+	 *
+	 * // Next SQL sentence is sent to the database system
+	 * INSERT INTO `robots` (`name`, `year`) VALUES (?, ?), (?, ?);
+	 * </code>
+	 *
+	 * @param 	string table
+	 * @param 	array rows
+	 * @param 	array fields
+	 * @param 	array dataTypes
+	 * @param 	int chunkSize Maximum number of rows per statement
+	 * @return 	boolean
+	 */
+	public function insertMany(var table, array! rows, var fields = null, var dataTypes = null, int chunkSize = 1000) -> boolean
+	{
+		var row, firstRow, field, value, bindType, escapedFields, insertSql,
+			rowPlaceholders, placeholders, insertValues, bindDataTypes, isDict, success, e;
+		int columns, maxRows, maxSize, chunkRows, chunkBytes, rowBytes, position;
+		boolean transaction = false;
+
+		if !count(rows) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		let firstRow = reset(rows);
+		if typeof firstRow != "array" || !count(firstRow) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		/**
+		 * Rows passed as dictionaries use their keys as fields
+		 */
+		let isDict = false;
+		if typeof fields != "array" && typeof key(firstRow) == "string" {
+			let fields = array_keys(firstRow);
+		}
+
+		if typeof fields == "array" {
+			if !count(fields) {
+				throw new Exception("Unable to insert into " . table . " without fields");
+			}
+			let fields = array_values(fields),
+				isDict = typeof key(firstRow) == "string";
+			let escapedFields = [];
+			for field in fields {
+				let escapedFields[] = this->escapeIdentifier(field);
+			}
+			let insertSql = "INSERT INTO " . this->escapeIdentifier(table) . " (" . join(", ", escapedFields) . ") VALUES ";
+		} else {
+			let insertSql = "INSERT INTO " . this->escapeIdentifier(table) . " VALUES ";
+		}
+
+		/**
+		 * Calculate the maximum number of rows per statement
+		 */
+		if typeof fields == "array" {
+			let columns = count(fields);
+		} else {
+			let columns = count(firstRow);
+		}
+
+		let maxRows = (int) (this->_maxBindParams / columns);
+
+		if chunkSize > 0 && chunkSize < maxRows {
+			let maxRows = chunkSize;
+		}
+
+		if maxRows < 1 {
+			let maxRows = 1;
+		}
+
+		let maxSize = this->_getMaxStatementSize();
+
+		let placeholders = [],
+			insertValues = [],
+			bindDataTypes = [],
+			chunkRows = 0,
+			chunkBytes = strlen(insertSql);
+
+		try {
+
+			for row in rows {
+
+				/**
+				 * Rows passed as dictionaries can have other keys, their values are taken by field
+				 */
+				if typeof row != "array" || (isDict && count(row) < columns) || (!isDict && count(row) != columns) {
+					throw new Exception("All the rows must have a value for every field");
+				}
+
+				/**
+				 * Flush the chunk if the row doesn't fit in the statement
+				 */
+				let rowBytes = strlen(join("", array_filter(row, "is_scalar"))) + columns * 4;
+				if chunkRows > 0 && (chunkRows >= maxRows || (maxSize > 0 && chunkBytes + rowBytes > maxSize)) {
+
+					if !transaction && !this->{"isUnderTransaction"}() {
+						this->{"begin"}();
+						let transaction = true;
+					}
+
+					if !this->_executeInsertChunk(insertSql, placeholders, insertValues, bindDataTypes) {
+						if transaction {
+							this->{"rollback"}();
+						}
+						return false;
+					}
+
+					let placeholders = [],
+						insertValues = [],
+						bindDataTypes = [],
+						chunkRows = 0,
+						chunkBytes = strlen(insertSql);
+				}
+
+				/**
+				 * Objects are casted using __toString, everything else is passed as "?"
+				 */
+				let rowPlaceholders = [];
+				for position in range(0, columns - 1) {
+
+					if isDict {
+						let field = fields[position];
+						if !fetch value, row[field] {
+							throw new Exception("The value of the field '" . field . "' is missing in a row");
+						}
+					} else {
+						let value = row[position];
+					}
+
+					if typeof value == "object" {
+						let rowPlaceholders[] = (string) value;
+						continue;
+					}
+
+					let rowPlaceholders[] = "?",
+						insertValues[] = value;
+
+					if typeof dataTypes == "array" {
+						if typeof value == "null" {
+							let bindDataTypes[] = Column::BIND_PARAM_NULL;
+						} else {
+							if !fetch bindType, dataTypes[position] {
+								throw new Exception("Incomplete number of bind types");
+							}
+							let bindDataTypes[] = bindType;
+						}
+					}
+				}
+
+				let placeholders[] = "(" . join(", ", rowPlaceholders) . ")",
+					chunkRows++,
+					chunkBytes += rowBytes;
+			}
+
+			let success = this->_executeInsertChunk(insertSql, placeholders, insertValues, bindDataTypes);
+
+		} catch \Exception, e {
+			if transaction {
+				this->{"rollback"}();
+			}
+			throw e;
+		}
+
+		if transaction {
+			if success {
+				this->{"commit"}();
+			} else {
+				this->{"rollback"}();
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * Executes a multi-row INSERT statement with the rows of a chunk
+	 */
+	protected function _executeInsertChunk(string! insertSql, array! placeholders, array! insertValues, array! bindDataTypes) -> boolean
+	{
+		if !count(bindDataTypes) {
+			return this->{"execute"}(insertSql . join(", ", placeholders), insertValues);
+		}
+
+		return this->{"execute"}(insertSql . join(", ", placeholders), insertValues, bindDataTypes);
+	}
+
+	/**
+	 * Returns the maximum size in bytes of a statement sent to the database system, zero means no limit
+	 */
+	protected function _getMaxStatementSize() -> int
+	{
+		return 0;
+	}
+
 	/**
 	 * Inserts data into a table using custom RBDM SQL syntax
 	 *
@@ -60,6 +60,23 @@ abstract class Pdo extends Adapter
 	 */
 	protected _affectedRows;
 
+	/**
+	 * Prepared statements reused by execute(), indexed by SQL text
+	 * in least recently used order
+	 */
+	protected _statementCache = [];
+
+	/**
+	 * Maximum number of prepared statements kept, 0 disables the cache
+	 */
+	protected _statementCacheSize = 0;
+
+	protected _statementCacheHits = 0;
+
+	protected _statementCacheMisses = 0;
+
+	protected _statementCacheEvictions = 0;
+
 	/**
 	 * Constructor for Phalcon\Db\Adapter\Pdo
 	 */
@@ -95,12 +112,17 @@ abstract class Pdo extends Adapter
 	public function connect(array descriptor = null) -> boolean
 	{
 		var username, password, dsnParts, dsnAttributes,
-			persistent, options, key, value;
+			persistent, options, key, value, statementCacheSize;
 
 		if empty descriptor {
 			let descriptor = (array) this->_descriptor;
 		}
 
+		/**
+		 * Statements prepared by a previous connection can't be reused
+		 */
+		let this->_statementCache = [];
+
 		/**
 		 * Check for a username or use null as default
 		 */
@@ -145,6 +167,14 @@ abstract class Pdo extends Adapter
 			unset descriptor["dialectClass"];
 		}
 
+		/**
+		 * Check if the prepared statements must be cached
+		 */
+		if fetch statementCacheSize, descriptor["statementCacheSize"] {
+			let this->_statementCacheSize = (int) statementCacheSize;
+			unset descriptor["statementCacheSize"];
+		}
+
 		/**
 		 * Check if the user has defined a custom dsn
 		 */
@@ -366,6 +396,15 @@ abstract class Pdo extends Adapter
 		return statement;
 	}
 
+	/**
+	 * Sends a SQL statement whose rows are read from the server as they are fetched.
+	 * Adapters whose driver always buffers the results behave like query()
+	 */
+	public function queryUnbuffered(string! sqlStatement, var bindParams = null, var bindTypes = null) -> <ResultInterface> | boolean
+	{
+		return this->query(sqlStatement, bindParams, bindTypes);
+	}
+
 	/**
 	 * Sends SQL statements to the database server returning the success state.
 	 * Use this method only when the SQL statement sent to the server doesn't return any rows
@@ -409,7 +448,7 @@ abstract class Pdo extends Adapter
 
 		let pdo = <\Pdo> this->_pdo;
 		if typeof bindParams == "array" {
-			let statement = pdo->prepare(sqlStatement);
+			let statement = this->_prepareCached(sqlStatement);
 			if typeof statement == "object" {
 				let newStatement = this->executePrepared(statement, bindParams, bindTypes),
 					affectedRows = newStatement->rowCount();
@@ -458,9 +497,131 @@ abstract class Pdo extends Adapter
 		if typeof pdo == "object" {
 			let this->_pdo = null;
 		}
+		let this->_statementCache = [];
 		return true;
 	}
 
+	/**
+	 * Sets the maximum number of prepared statements reused by execute().
+	 * A value of 0 disables the cache. It can also be set with the "statementCacheSize"
+	 * option of the descriptor
+	 *
+	 * Statements of query() are never cached, their results are still read
+	 * after the next query with the same SQL text is executed
+	 *
+	 *<code>
+	 * $connection->setStatementCacheSize(64);
+	 *</code>
+	 */
+	public function setStatementCacheSize(int size) -> <Pdo>
+	{
+		let this->_statementCacheSize = size;
+
+		if size <= 0 {
+			let this->_statementCache = [];
+		} else {
+			while count(this->_statementCache) > size {
+				this->_evictStatement();
+			}
+		}
+
+		return this;
+	}
+
+	/**
+	 * Returns the maximum number of prepared statements reused by execute()
+	 */
+	public function getStatementCacheSize() -> int
+	{
+		return this->_statementCacheSize;
+	}
+
+	/**
+	 * Returns the number of cached statements and the hits, misses and evictions of the cache
+	 *
+	 *<code>
+	 * print_r(
+	 *     $connection->getStatementCacheStats()
+	 * );
+	 *</code>
+	 */
+	public function getStatementCacheStats() -> array
+	{
+		return [
+			"size"      : count(this->_statementCache),
+			"hits"      : this->_statementCacheHits,
+			"misses"    : this->_statementCacheMisses,
+			"evictions" : this->_statementCacheEvictions
+		];
+	}
+
+	/**
+	 * Removes the cached prepared statements and resets the counters
+	 */
+	public function clearStatementCache() -> void
+	{
+		let this->_statementCache = [],
+			this->_statementCacheHits = 0,
+			this->_statementCacheMisses = 0,
+			this->_statementCacheEvictions = 0;
+	}
+
+	/**
+	 * Returns a prepared statement for the SQL text reusing the cached one if any
+	 */
+	protected function _prepareCached(string! sqlStatement) -> <\PDOStatement> | boolean
+	{
+		var statement;
+
+		if this->_statementCacheSize <= 0 {
+			return this->_pdo->prepare(sqlStatement);
+		}
+
+		if fetch statement, this->_statementCache[sqlStatement] {
+
+			/**
+			 * Move the statement to the end of the list, it's now the most recently used
+			 */
+			unset this->_statementCache[sqlStatement];
+			let this->_statementCache[sqlStatement] = statement;
+
+			let this->_statementCacheHits++;
+
+			statement->closeCursor();
+			return statement;
+		}
+
+		let this->_statementCacheMisses++;
+
+		let statement = this->_pdo->prepare(sqlStatement);
+		if typeof statement != "object" {
+			return statement;
+		}
+
+		while count(this->_statementCache) >= this->_statementCacheSize {
+			this->_evictStatement();
+		}
+
+		let this->_statementCache[sqlStatement] = statement;
+
+		return statement;
+	}
+
+	/**
+	 * Removes the least recently used statement from the cache
+	 */
+	protected function _evictStatement() -> void
+	{
+		var sqlStatement, statement;
+
+		for sqlStatement, statement in this->_statementCache {
+			break;
+		}
+
+		unset this->_statementCache[sqlStatement];
+		let this->_statementCacheEvictions++;
+	}
+
 	/**
 	 * Escapes a value to avoid SQL injections according to the active charset in the connection
 	 *
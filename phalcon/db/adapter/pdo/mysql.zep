@@ -24,6 +24,7 @@ use Phalcon\Db\Column;
 use Phalcon\Db\Index;
 use Phalcon\Db\Reference;
 use Phalcon\Db\IndexInterface;
+use Phalcon\Db\ResultInterface;
 use Phalcon\Db\Adapter\Pdo as PdoAdapter;
 
 /**
@@ -52,6 +53,67 @@ class Mysql extends PdoAdapter
 
 	protected _dialectType = "mysql";
 
+	protected _maxAllowedPacket;
+
+	/**
+	 * Returns half the max_allowed_packet of the server, leaving room for
+	 * the escaping of the values when the prepares are emulated
+	 */
+	protected function _getMaxStatementSize() -> int
+	{
+		var maxAllowedPacket;
+
+		let maxAllowedPacket = this->_maxAllowedPacket;
+		if maxAllowedPacket === null {
+			let maxAllowedPacket = (int) (this->fetchColumn("SELECT @@max_allowed_packet") / 2),
+				this->_maxAllowedPacket = maxAllowedPacket;
+		}
+
+		return maxAllowedPacket;
+	}
+
+	/**
+	 * Sends a SQL statement whose rows are read from the server as they are fetched
+	 * instead of being copied to the client memory. Other statements can't be sent
+	 * to the connection until every row has been fetched
+	 *
+	 *<code>
+	 * $result = $connection->queryUnbuffered(
+	 *     "SELECT * FROM robots WHERE type = ?",
+	 *     [
+	 *         "mechanical",
+	 *     ]
+	 * );
+	 *</code>
+	 */
+	public function queryUnbuffered(string! sqlStatement, var bindParams = null, var bindTypes = null) -> <ResultInterface> | boolean
+	{
+		var pdo, result, statementCacheSize, e;
+
+		let pdo = <\Pdo> this->_pdo;
+
+		/**
+		 * A cached statement would keep the cursor open after the resultset is released
+		 */
+		let statementCacheSize = this->_statementCacheSize,
+			this->_statementCacheSize = 0;
+
+		pdo->setAttribute(\Pdo::MYSQL_ATTR_USE_BUFFERED_QUERY, false);
+
+		try {
+			let result = this->query(sqlStatement, bindParams, bindTypes);
+		} catch \Exception, e {
+			pdo->setAttribute(\Pdo::MYSQL_ATTR_USE_BUFFERED_QUERY, true);
+			let this->_statementCacheSize = statementCacheSize;
+			throw e;
+		}
+
+		pdo->setAttribute(\Pdo::MYSQL_ATTR_USE_BUFFERED_QUERY, true);
+		let this->_statementCacheSize = statementCacheSize;
+
+		return result;
+	}
+
 	/**
 	 * Returns an array of Phalcon\Db\Column objects describing a table
 	 *
@@ -52,6 +52,11 @@ class Sqlite extends PdoAdapter
 
 	protected _dialectType = "sqlite";
 
+	/**
+	 * Default SQLITE_MAX_VARIABLE_NUMBER
+	 */
+	protected _maxBindParams = 999;
+
 	/**
 	 * This method is automatically called in Phalcon\Db\Adapter\Pdo constructor.
 	 * Call it when you need to restore a database connection.
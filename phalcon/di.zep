@@ -24,6 +24,8 @@ use Phalcon\DiInterface;
 use Phalcon\Di\Service;
 use Phalcon\Di\ServiceInterface;
 use Phalcon\Di\Exception;
+use Phalcon\Di\Compiler;
+use Phalcon\Di\Proxy;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Di\InjectionAwareInterface;
 
@@ -88,6 +90,26 @@ class Di implements DiInterface
 	 */
 	protected _eventsManager;
 
+	/**
+	 * Whether the services can't be changed anymore
+	 */
+	protected _frozen = false;
+
+	/**
+	 * Factory generated by Phalcon\Di\Compiler
+	 */
+	protected _factory;
+
+	/**
+	 * Factory methods and shared flag of the compiled services
+	 */
+	protected _compiled = [];
+
+	/**
+	 * Interfaces of the services resolved through proxies
+	 */
+	protected _lazy = [];
+
 	/**
 	 * Latest DI build
 	 */
@@ -127,8 +149,14 @@ class Di implements DiInterface
 	public function set(string! name, var definition, boolean shared = false) -> <ServiceInterface>
 	{
 		var service;
+
+		if this->_frozen {
+			throw new Exception("Service '" . name . "' can't be registered because the dependency injection container is frozen");
+		}
+
 		let service = new Service(name, definition, shared),
 			this->_services[name] = service;
+		unset this->_lazy[name];
 		return service;
 	}
 
@@ -140,14 +168,50 @@ class Di implements DiInterface
 		return this->set(name, definition, true);
 	}
 
+	/**
+	 * Registers a shared service resolved through a Phalcon\Di\Proxy. The
+	 * definition is only resolved when a method of the proxy is called. If
+	 * an interface is passed the proxy implements it, so it can be injected
+	 * into arguments type-hinted with that interface
+	 *
+	 *<code>
+	 * $di->setLazy(
+	 *     "db",
+	 *     function () {
+	 *         return new \Phalcon\Db\Adapter\Pdo\Mysql($config);
+	 *     },
+	 *     \Phalcon\Db\AdapterInterface::class
+	 * );
+	 *</code>
+	 */
+	public function setLazy(string! name, var definition, string interfaceName = null) -> <ServiceInterface>
+	{
+		var service;
+
+		let service = this->set(name, definition, true);
+
+		if interfaceName {
+			let this->_lazy[name] = interfaceName;
+		} else {
+			let this->_lazy[name] = "";
+		}
+
+		return service;
+	}
+
 	/**
 	 * Removes a service in the services container
 	 * It also removes any shared instance created for the service
 	 */
 	public function remove(string! name)
 	{
+		if this->_frozen {
+			throw new Exception("Service '" . name . "' can't be removed because the dependency injection container is frozen");
+		}
+
 		unset this->_services[name];
 		unset this->_sharedInstances[name];
+		unset this->_lazy[name];
 	}
 
 	/**
@@ -159,6 +223,10 @@ class Di implements DiInterface
 	{
 		var service;
 
+		if this->_frozen {
+			throw new Exception("Service '" . name . "' can't be registered because the dependency injection container is frozen");
+		}
+
 		if !isset this->_services[name] {
 			let service = new Service(name, definition, shared),
 				this->_services[name] = service;
@@ -173,7 +241,12 @@ class Di implements DiInterface
 	 */
 	public function setRaw(string! name, <ServiceInterface> rawDefinition) -> <ServiceInterface>
 	{
+		if this->_frozen {
+			throw new Exception("Service '" . name . "' can't be registered because the dependency injection container is frozen");
+		}
+
 		let this->_services[name] = rawDefinition;
+		unset this->_lazy[name];
 		return rawDefinition;
 	}
 
@@ -210,7 +283,8 @@ class Di implements DiInterface
 	 */
 	public function get(string! name, parameters = null) -> var
 	{
-		var service, eventsManager, instance = null;
+		var service, eventsManager, instance = null, compiled, factory, method,
+			interfaceName, className;
 
 		let eventsManager = <ManagerInterface> this->_eventsManager;
 
@@ -223,7 +297,35 @@ class Di implements DiInterface
 		}
 
 		if typeof instance != "object" {
-			if fetch service, this->_services[name] {
+			if parameters === null && fetch interfaceName, this->_lazy[name] {
+				/**
+				 * Lazy services return a proxy that resolves the definition on the first call
+				 */
+				if !fetch instance, this->_sharedInstances[name] {
+					let service = this->_services[name];
+					if interfaceName {
+						let className = Proxy::getProxyClass(interfaceName),
+							instance = new {className}(this, service);
+					} else {
+						let instance = new Proxy(this, service);
+					}
+					let this->_sharedInstances[name] = instance;
+				}
+			} elseif parameters === null && fetch compiled, this->_compiled[name] {
+				/**
+				 * Compiled services are built by the factory without resolving their definition
+				 */
+				let factory = this->_factory,
+					method = compiled[0];
+				if compiled[1] {
+					if !fetch instance, this->_sharedInstances[name] {
+						let instance = factory->{method}(this),
+							this->_sharedInstances[name] = instance;
+					}
+				} else {
+					let instance = factory->{method}(this);
+				}
+			} elseif fetch service, this->_services[name] {
 				/**
 				 * The service is registered in the DI
 				 */
@@ -249,7 +351,12 @@ class Di implements DiInterface
 		 */
 		if typeof instance == "object" {
 			if instance instanceof InjectionAwareInterface {
-				instance->setDI(this);
+				/**
+				 * Proxies pass the DI to the real service when it's resolved
+				 */
+				if !(instance instanceof Proxy) {
+					instance->setDI(this);
+				}
 			}
 		}
 
@@ -326,6 +433,100 @@ class Di implements DiInterface
 		return this->_services;
 	}
 
+	/**
+	 * Returns the source of a PHP class that builds the services registered
+	 * with a class name or an array definition, see Phalcon\Di\Compiler
+	 *
+	 *<code>
+	 * file_put_contents("app/cache/CompiledDi.php", $di->compile("CompiledDi"));
+	 *</code>
+	 */
+	public function compile(string! className) -> string
+	{
+		var compiler;
+
+		let compiler = new Compiler();
+
+		return compiler->compile(this, className);
+	}
+
+	/**
+	 * Writes the compiled factory class to a file, the file is replaced
+	 * atomically so concurrent requests never include a partial class
+	 */
+	public function dump(string! className, string! path) -> boolean
+	{
+		var temporary;
+
+		let temporary = path . "." . uniqid("", true);
+
+		if file_put_contents(temporary, this->compile(className)) === false {
+			throw new Exception("The compiled container can't be written to '" . path . "'");
+		}
+
+		if !rename(temporary, path) {
+			unlink(temporary);
+			throw new Exception("The compiled container can't be written to '" . path . "'");
+		}
+
+		return true;
+	}
+
+	/**
+	 * Freezes the services of the container. Registering or removing services
+	 * afterwards throws an exception. If a factory generated by
+	 * Phalcon\Di::compile() is passed its methods build the compiled services
+	 *
+	 *<code>
+	 * require "app/cache/CompiledDi.php";
+	 *
+	 * $di->freeze(new CompiledDi());
+	 *</code>
+	 */
+	public function freeze(var factory = null) -> <Di>
+	{
+		var methods, name, method, service;
+
+		let this->_compiled = [];
+
+		if typeof factory == "object" {
+
+			if !method_exists(factory, "getMethods") {
+				throw new Exception("The factory must be generated by Phalcon\\Di::compile()");
+			}
+
+			let methods = factory->getMethods();
+			if typeof methods != "array" {
+				throw new Exception("The factory must be generated by Phalcon\\Di::compile()");
+			}
+
+			/**
+			 * Only services that are still registered and aren't lazy use the factory
+			 */
+			for name, method in methods {
+				if isset this->_lazy[name] {
+					continue;
+				}
+				if fetch service, this->_services[name] {
+					let this->_compiled[name] = [method, service->isShared()];
+				}
+			}
+		}
+
+		let this->_factory = factory,
+			this->_frozen = true;
+
+		return this;
+	}
+
+	/**
+	 * Check whether the services of the container are frozen
+	 */
+	public function isFrozen() -> boolean
+	{
+		return this->_frozen;
+	}
+
 	/**
 	 * Check if a service is registered using the array syntax
 	 */
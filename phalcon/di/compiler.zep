@@ -0,0 +1,298 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Di;
+
+use Phalcon\DiInterface;
+
+/**
+ * Phalcon\Di\Compiler
+ *
+ * Generates the source of a PHP class with one factory method per service
+ * registered with a class name or an array definition. The generated file
+ * can be cached by opcache and passed to Phalcon\Di::freeze(), so these
+ * services are built without resolving their definitions on every request.
+ * Closures and already resolved instances can't be compiled and keep being
+ * resolved by the container.
+ *
+ *<code>
+ * $compiler = new \Phalcon\Di\Compiler();
+ *
+ * file_put_contents(
+ *     "app/cache/CompiledDi.php",
+ *     $compiler->compile($di, "CompiledDi")
+ * );
+ *</code>
+ */
+class Compiler
+{
+
+	/**
+	 * Returns the source of a factory class for the services of a container
+	 */
+	public function compile(<DiInterface> dependencyInjector, string! className) -> string
+	{
+		var services, name, service, definition, code, methods, position,
+			namespaceName, shortName, method, body;
+		int number = 0;
+
+		let services = dependencyInjector->getServices(),
+			methods = [],
+			body = "";
+
+		for name, service in services {
+
+			let definition = service->getDefinition(),
+				code = this->_compileDefinition(definition);
+
+			/**
+			 * The service keeps being resolved by the container
+			 */
+			if typeof code != "string" {
+				continue;
+			}
+
+			let method = "service" . number,
+				methods[name] = method,
+				number++;
+
+			let body .= "\n    public function " . method . "($di)\n    {\n" . code . "    }\n";
+		}
+
+		let className = trim(className, "\\"),
+			position = strrpos(className, "\\");
+
+		if position !== false {
+			let namespaceName = "namespace " . substr(className, 0, position) . ";\n\n",
+				shortName = substr(className, position + 1);
+		} else {
+			let namespaceName = "",
+				shortName = className;
+		}
+
+		return "<?php\n\n" . namespaceName . "class " . shortName . "\n{\n" .
+			"    public function getMethods()\n    {\n        return " . var_export(methods, true) . ";\n    }\n" .
+			body . "}\n";
+	}
+
+	/**
+	 * Returns the body of the factory method of a definition or false if it can't be compiled
+	 */
+	protected function _compileDefinition(definition) -> string | boolean
+	{
+		var className, arguments, calls, properties, position, method,
+			methodName, property, propertyName, propertyValue, value, code;
+
+		/**
+		 * String definitions are class names without parameters
+		 */
+		if typeof definition == "string" {
+			if !class_exists(definition) {
+				return false;
+			}
+			return "        return new \\" . ltrim(definition, "\\") . "();\n";
+		}
+
+		if typeof definition != "array" {
+			return false;
+		}
+
+		if !fetch className, definition["className"] {
+			return false;
+		}
+
+		if typeof className != "string" {
+			return false;
+		}
+
+		let arguments = [];
+		if fetch arguments, definition["arguments"] {
+			let arguments = this->_compileParameters(arguments);
+			if typeof arguments != "array" {
+				return false;
+			}
+		}
+
+		let code = "        $instance = new \\" . ltrim(className, "\\") . "(" . join(", ", arguments) . ");\n";
+
+		/**
+		 * Setter injection
+		 */
+		if fetch calls, definition["calls"] {
+
+			if typeof calls != "array" {
+				return false;
+			}
+
+			for position, method in calls {
+
+				if typeof method != "array" {
+					return false;
+				}
+
+				if !fetch methodName, method["method"] {
+					return false;
+				}
+
+				let arguments = [];
+				if fetch arguments, method["arguments"] {
+					let arguments = this->_compileParameters(arguments);
+					if typeof arguments != "array" {
+						return false;
+					}
+				}
+
+				let code .= "        $instance->{" . var_export(methodName, true) . "}(" . join(", ", arguments) . ");\n";
+			}
+		}
+
+		/**
+		 * Properties injection
+		 */
+		if fetch properties, definition["properties"] {
+
+			if typeof properties != "array" {
+				return false;
+			}
+
+			for position, property in properties {
+
+				if typeof property != "array" {
+					return false;
+				}
+
+				if !fetch propertyName, property["name"] {
+					return false;
+				}
+
+				if !fetch propertyValue, property["value"] {
+					return false;
+				}
+
+				let value = this->_compileParameter(propertyValue);
+				if typeof value != "string" {
+					return false;
+				}
+
+				let code .= "        $instance->{" . var_export(propertyName, true) . "} = " . value . ";\n";
+			}
+		}
+
+		return code . "        return $instance;\n";
+	}
+
+	/**
+	 * Returns the PHP expressions of an array of parameters or false if one of them can't be compiled
+	 */
+	protected function _compileParameters(arguments) -> array | boolean
+	{
+		var argument, value, compiled;
+
+		if typeof arguments != "array" {
+			return false;
+		}
+
+		let compiled = [];
+		for argument in arguments {
+			let value = this->_compileParameter(argument);
+			if typeof value != "string" {
+				return false;
+			}
+			let compiled[] = value;
+		}
+
+		return compiled;
+	}
+
+	/**
+	 * Returns the PHP expression that resolves a constructor/call parameter
+	 */
+	protected function _compileParameter(argument) -> string | boolean
+	{
+		var type, name, value, instanceArguments;
+
+		if typeof argument != "array" {
+			return false;
+		}
+
+		if !fetch type, argument["type"] {
+			return false;
+		}
+
+		/**
+		 * Services are obtained from the DI when the factory is called
+		 */
+		if type == "service" {
+			if !fetch name, argument["name"] {
+				return false;
+			}
+			return "$di->get(" . var_export(name, true) . ")";
+		}
+
+		/**
+		 * Values are exported as literals
+		 */
+		if type == "parameter" {
+			if !fetch value, argument["value"] {
+				return false;
+			}
+			if !this->_isExportable(value) {
+				return false;
+			}
+			return var_export(value, true);
+		}
+
+		if type == "instance" {
+			if !fetch name, argument["className"] {
+				return false;
+			}
+			if fetch instanceArguments, argument["arguments"] {
+				if !this->_isExportable(instanceArguments) {
+					return false;
+				}
+				return "$di->get(" . var_export(name, true) . ", " . var_export(instanceArguments, true) . ")";
+			}
+			return "$di->get(" . var_export(name, true) . ")";
+		}
+
+		return false;
+	}
+
+	/**
+	 * Checks whether a value can be written as a PHP literal
+	 */
+	protected function _isExportable(value) -> boolean
+	{
+		var item;
+
+		if typeof value == "object" || typeof value == "resource" {
+			return false;
+		}
+
+		if typeof value == "array" {
+			for item in value {
+				if !this->_isExportable(item) {
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,368 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Di;
+
+use Phalcon\DiInterface;
+use Phalcon\Di\ServiceInterface;
+use Phalcon\Di\InjectionAwareInterface;
+
+/**
+ * Phalcon\Di\Proxy
+ *
+ * Stands in for a service registered with Phalcon\Di::setLazy(). The real
+ * service is resolved on the first method call or property access, so
+ * requests that never use it don't pay for its construction (e.g. opening
+ * a database connection).
+ *
+ * When the service is registered with an interface, a subclass implementing
+ * it is generated, written to the proxies directory and included, so the
+ * proxy can be passed to arguments type-hinted with that interface. The
+ * directory must be set explicitly and must not be writable by other users,
+ * the name of every file contains the hash of its source, so proxies of
+ * interfaces that changed are generated again.
+ *
+ *<code>
+ * use Phalcon\Di\Proxy;
+ *
+ * Proxy::setDirectory("app/cache/proxies/");
+ *
+ * $di->setLazy(
+ *     "db",
+ *     function () {
+ *         return new \Phalcon\Db\Adapter\Pdo\Mysql($config);
+ *     },
+ *     \Phalcon\Db\AdapterInterface::class
+ * );
+ *
+ * // No connection is opened until a method is called
+ * $db = $di->getShared("db");
+ *</code>
+ */
+class Proxy
+{
+
+	protected _dependencyInjector;
+
+	protected _service;
+
+	protected _instance;
+
+	protected _resolved = false;
+
+	/**
+	 * Directory where the proxies of interfaces are generated
+	 */
+	protected static _directory;
+
+	/**
+	 * Phalcon\Di\Proxy constructor
+	 */
+	public final function __construct(<DiInterface> dependencyInjector, <ServiceInterface> service)
+	{
+		let this->_dependencyInjector = dependencyInjector,
+			this->_service = service;
+	}
+
+	/**
+	 * Resolves the real service the first time it's requested
+	 */
+	public function getProxyInstance() -> var
+	{
+		var instance, dependencyInjector;
+
+		if this->_resolved {
+			return this->_instance;
+		}
+
+		let dependencyInjector = this->_dependencyInjector,
+			instance = this->_service->resolve(null, dependencyInjector);
+
+		if typeof instance == "object" {
+			if instance instanceof InjectionAwareInterface {
+				instance->setDI(dependencyInjector);
+			}
+		}
+
+		let this->_instance = instance,
+			this->_resolved = true;
+
+		return instance;
+	}
+
+	/**
+	 * Check whether the real service was already resolved
+	 */
+	public function isProxyResolved() -> boolean
+	{
+		return this->_resolved;
+	}
+
+	/**
+	 * Forwards method calls to the real service
+	 */
+	public function __call(string! method, arguments) -> var
+	{
+		return call_user_func_array([this->getProxyInstance(), method], arguments);
+	}
+
+	/**
+	 * Forwards property reads to the real service
+	 */
+	public function __get(string! property) -> var
+	{
+		var instance;
+
+		let instance = this->getProxyInstance();
+
+		return instance->{property};
+	}
+
+	/**
+	 * Forwards property writes to the real service
+	 */
+	public function __set(string! property, value) -> void
+	{
+		var instance;
+
+		let instance = this->getProxyInstance(),
+			instance->{property} = value;
+	}
+
+	/**
+	 * Forwards isset() on properties to the real service
+	 */
+	public function __isset(string! property) -> boolean
+	{
+		var instance;
+
+		let instance = this->getProxyInstance();
+
+		return isset instance->{property};
+	}
+
+	/**
+	 * Sets the directory where the proxies of interfaces are generated
+	 */
+	public static function setDirectory(string! directory) -> void
+	{
+		let self::_directory = directory;
+	}
+
+	/**
+	 * Returns the directory where the proxies of interfaces are generated
+	 */
+	public static function getDirectory() -> string
+	{
+		var directory;
+
+		let directory = self::_directory;
+		if typeof directory != "string" || directory === "" {
+			throw new Exception("The directory of the proxies must be set with Phalcon\\Di\\Proxy::setDirectory()");
+		}
+
+		return rtrim(directory, "\\/") . DIRECTORY_SEPARATOR;
+	}
+
+	/**
+	 * Returns the name of the proxy class implementing an interface, generating it if needed
+	 */
+	public static function getProxyClass(string! interfaceName) -> string
+	{
+		var className, code, path, temporary;
+
+		if !interface_exists(interfaceName) {
+			throw new Exception("Interface '" . interfaceName . "' doesn't exist");
+		}
+
+		let className = "PhalconDiProxy_" . md5(strtolower(ltrim(interfaceName, "\\")));
+		if class_exists(className, false) {
+			return className;
+		}
+
+		/**
+		 * A file written for another version of the interface is never included
+		 */
+		let code = self::generate(interfaceName, className),
+			path = self::getDirectory() . className . "_" . md5(code) . ".php";
+
+		if !file_exists(path) {
+			let temporary = path . "." . uniqid("", true);
+			if file_put_contents(temporary, code) === false {
+				throw new Exception("The proxy of '" . interfaceName . "' can't be written to '" . path . "'");
+			}
+			if !rename(temporary, path) {
+				unlink(temporary);
+				throw new Exception("The proxy of '" . interfaceName . "' can't be written to '" . path . "'");
+			}
+		}
+
+		require path;
+
+		return className;
+	}
+
+	/**
+	 * Returns the source of a proxy class implementing an interface
+	 */
+	public static function generate(string! interfaceName, string! className) -> string
+	{
+		var reflection, method, methodName, parameter, parameters, arguments,
+			type, code, returnType, forward;
+		boolean byReference;
+
+		let reflection = new \ReflectionClass(interfaceName),
+			code = "";
+
+		for method in reflection->getMethods() {
+
+			let methodName = method->getName();
+
+			/**
+			 * Magic methods of the proxy already satisfy the interface
+			 */
+			if method_exists("Phalcon\\Di\\Proxy", methodName) {
+				continue;
+			}
+
+			let parameters = [],
+				arguments = [],
+				byReference = false;
+
+			for parameter in method->getParameters() {
+
+				let type = self::_getTypeHint(parameter);
+
+				if parameter->isPassedByReference() {
+					let type .= "&",
+						byReference = true;
+				}
+
+				if method_exists(parameter, "isVariadic") && parameter->isVariadic() {
+					let parameters[] = type . "...$" . parameter->getName(),
+						arguments[] = "...$" . parameter->getName();
+					continue;
+				}
+
+				if parameter->isOptional() {
+					if parameter->isDefaultValueAvailable() {
+						let parameters[] = type . "$" . parameter->getName() . " = " . var_export(parameter->getDefaultValue(), true);
+					} else {
+						let parameters[] = type . "$" . parameter->getName() . " = null";
+					}
+				} else {
+					let parameters[] = type . "$" . parameter->getName();
+				}
+
+				let arguments[] = "$" . parameter->getName();
+			}
+
+			let returnType = "";
+			if method_exists(method, "hasReturnType") && method->hasReturnType() {
+				let returnType = ": " . self::_getTypeName(method->getReturnType(), method->getReturnType()->allowsNull());
+			}
+
+			/**
+			 * Static methods can't be forwarded to an instance
+			 */
+			if method->isStatic() {
+				let code .= "\n    public static function " . methodName . "(" . join(", ", parameters) . ")" . returnType . "\n    {\n" .
+					"        throw new \\Phalcon\\Di\\Exception(\"Static method '" . methodName . "' can't be called on a proxy\");\n    }\n";
+				continue;
+			}
+
+			/**
+			 * Arguments are forwarded as received so optional ones keep the defaults of the
+			 * real service, except when some of them are passed by reference
+			 */
+			if byReference {
+				let forward = "$this->getProxyInstance()->" . methodName . "(" . join(", ", arguments) . ")";
+			} else {
+				let forward = "call_user_func_array([$this->getProxyInstance(), '" . methodName . "'], func_get_args())";
+			}
+
+			if returnType == ": void" {
+				let forward = "        " . forward . ";\n";
+			} else {
+				let forward = "        return " . forward . ";\n";
+			}
+
+			let code .= "\n    public function " . methodName . "(" . join(", ", parameters) . ")" . returnType . "\n    {\n" . forward . "    }\n";
+		}
+
+		return "<?php\n\nclass " . className . " extends \\Phalcon\\Di\\Proxy implements \\" . ltrim(interfaceName, "\\") . "\n{" . code . "}\n";
+	}
+
+	/**
+	 * Returns the type hint of a parameter followed by a space
+	 */
+	protected static function _getTypeHint(<\ReflectionParameter> parameter) -> string
+	{
+		var hint;
+
+		if method_exists(parameter, "hasType") {
+			if !parameter->hasType() {
+				return "";
+			}
+			return self::_getTypeName(parameter->getType(), parameter->allowsNull() && !parameter->isOptional()) . " ";
+		}
+
+		if parameter->isArray() {
+			return "array ";
+		}
+
+		if parameter->isCallable() {
+			return "callable ";
+		}
+
+		let hint = parameter->getClass();
+		if typeof hint == "object" {
+			return "\\" . hint->getName() . " ";
+		}
+
+		return "";
+	}
+
+	/**
+	 * Returns the source of a reflected type
+	 */
+	protected static function _getTypeName(<\ReflectionType> type, boolean nullable) -> string
+	{
+		var name;
+
+		if method_exists(type, "getName") {
+			let name = type->getName();
+		} else {
+			let name = (string) type;
+		}
+
+		if !type->isBuiltin() && name != "self" {
+			let name = "\\" . name;
+		}
+
+		/**
+		 * Nullable types were added in PHP 7.1
+		 */
+		if nullable && name != "mixed" && method_exists(type, "getName") {
+			let name = "?" . name;
+		}
+
+		return name;
+	}
+}
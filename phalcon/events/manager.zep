@@ -41,6 +41,17 @@ class Manager implements ManagerInterface
 
 	protected _responses;
 
+	/**
+	 * Handlers of every fired event type compiled in the order they are notified,
+	 * rebuilt when the listeners change
+	 */
+	protected _dispatchTable = [];
+
+	/**
+	 * Whether the classes of the handlers implement the methods of the events
+	 */
+	protected _handlerMethods = [];
+
 	/**
 	 * Attach a listener to the events manager
 	 *
@@ -56,6 +67,8 @@ class Manager implements ManagerInterface
 			throw new Exception("Event handler must be an Object");
 		}
 
+		let this->_dispatchTable = [];
+
 		if !fetch priorityQueue, this->_events[eventType] {
 
 			if this->_enablePriorities {
@@ -99,6 +112,8 @@ class Manager implements ManagerInterface
 			throw new Exception("Event handler must be an Object");
 		}
 
+		let this->_dispatchTable = [];
+
 		if fetch priorityQueue, this->_events[eventType] {
 
 			if typeof priorityQueue == "object" {
@@ -178,6 +193,8 @@ class Manager implements ManagerInterface
 	 */
 	public function detachAll(string! type = null)
 	{
+		let this->_dispatchTable = [];
+
 		if type === null {
 			let this->_events = null;
 		} else {
@@ -196,8 +213,7 @@ class Manager implements ManagerInterface
 	 */
 	public final function fireQueue(var queue, <EventInterface> event)
 	{
-		var status, arguments, eventName, data, iterator, source, handler;
-		boolean collect, cancelable;
+		var eventName;
 
 		if typeof queue != "array" {
 			if typeof queue == "object" {
@@ -214,217 +230,240 @@ class Manager implements ManagerInterface
 			}
 		}
 
-		let status = null, arguments = null;
-
 		// Get the event type
 		let eventName = event->getType();
 		if typeof eventName != "string" {
 			throw new Exception("The event type not valid");
 		}
 
-		// Get the object who triggered the event
-		let source = event->getSource();
-
-		// Get extra data passed to the event
-		let data = event->getData();
+		return this->_fireHandlers(this->_compileQueue(queue, eventName), event, eventName);
+	}
 
-		// Tell if the event is cancelable
-		let cancelable = (boolean) event->isCancelable();
+	/**
+	 * Fires an event in the events manager causing the active listeners to be notified about it
+	 *
+	 *<code>
+	 *	$eventsManager->fire("db", $connection);
+	 *</code>
+	 *
+	 * @param string eventType
+	 * @param object source
+	 * @param mixed  data
+	 * @param boolean cancelable
+	 * @return mixed
+	 */
+	public function fire(string! eventType, source, data = null, boolean cancelable = true)
+	{
+		var events, dispatch, eventName, typeHandlers, eventHandlers, event, status;
 
-		// Responses need to be traced?
-		let collect = (boolean) this->_collect;
+		let events = this->_events;
+		if typeof events != "array" {
+			return null;
+		}
 
-		if typeof queue == "object" {
+		if !fetch dispatch, this->_dispatchTable[eventType] {
 
-			// We need to clone the queue before iterate over it
-			let iterator = clone queue;
+			// All valid events must have a colon separator
+			if !memstr(eventType, ":") {
+				throw new Exception("Invalid event type " . eventType);
+			}
 
-			// Move the queue to the top
-			iterator->top();
+			let dispatch = this->_compileDispatch(eventType),
+				this->_dispatchTable[eventType] = dispatch;
+		}
 
-			while iterator->valid() {
+		// Responses must be traced?
+		if this->_collect {
+			let this->_responses = null;
+		}
 
-				// Get the current data
-				let handler = iterator->current();
-				iterator->next();
+		let eventName = dispatch[0],
+			typeHandlers = dispatch[1],
+			eventHandlers = dispatch[2];
 
-				// Only handler objects are valid
-				if typeof handler == "object" {
+		// Nobody is listening, the event isn't created
+		if empty typeHandlers && empty eventHandlers {
+			return null;
+		}
 
-					// Check if the event is a closure
-					if handler instanceof \Closure {
+		let status = null,
+			event = null;
 
-						// Create the closure arguments
-						if arguments === null {
-							let arguments = [event, source, data];
-						}
+		// Notify the listeners of the events grouped by type
+		if typeof typeHandlers == "array" {
 
-						// Call the function in the PHP userland
-						let status = call_user_func_array(handler, arguments);
+			if count(typeHandlers) {
 
-						// Trace the response
-						if collect {
-							let this->_responses[] = status;
-						}
+				// Create the event context
+				let event = new Event(eventName, source, data, cancelable);
 
-						if cancelable {
+				// Call the events queue
+				let status = this->_fireHandlers(typeHandlers, event, eventName);
+			}
+		}
 
-							// Check if the event was stopped by the user
-							if event->isStopped() {
-								break;
-							}
-						}
+		// Notify the listeners of the event type itself
+		if typeof eventHandlers == "array" {
 
-					} else {
+			let status = null;
 
-						// Check if the listener has implemented an event with the same name
-						if method_exists(handler, eventName) {
+			if count(eventHandlers) {
 
-							// Call the function in the PHP userland
-							let status = handler->{eventName}(event, source, data);
+				// Create the event if it wasn't created before
+				if event === null {
+					let event = new Event(eventName, source, data, cancelable);
+				}
 
-							// Collect the response
-							if collect {
-								let this->_responses[] = status;
-							}
+				// Call the events queue
+				let status = this->_fireHandlers(eventHandlers, event, eventName);
+			}
+		}
 
-							if cancelable {
+		return status;
+	}
 
-								// Check if the event was stopped by the user
-								if event->isStopped() {
-									break;
-								}
-							}
-						}
-					}
-				}
-			}
+	/**
+	 * Builds the entry of the dispatch table for an event type: the event name and the
+	 * handlers of the events grouped by type and of the event type itself, null if there
+	 * aren't listeners attached to them
+	 */
+	protected function _compileDispatch(string! eventType) -> array
+	{
+		var events, eventParts, eventName, queue, typeHandlers, eventHandlers;
 
-		} else {
+		let events = this->_events,
+			eventParts = explode(":", eventType),
+			eventName = eventParts[1],
+			typeHandlers = null,
+			eventHandlers = null;
 
-			for handler in queue {
+		if fetch queue, events[eventParts[0]] {
+			if typeof queue == "object" || typeof queue == "array" {
+				let typeHandlers = this->_compileQueue(queue, eventName);
+			}
+		}
 
-				// Only handler objects are valid
-				if typeof handler == "object" {
+		if fetch queue, events[eventType] {
+			if typeof queue == "object" || typeof queue == "array" {
+				let eventHandlers = this->_compileQueue(queue, eventName);
+			}
+		}
 
-					// Check if the event is a closure
-					if handler instanceof \Closure {
+		return [eventName, typeHandlers, eventHandlers];
+	}
 
-						// Create the closure arguments
-						if arguments === null {
-							let arguments = [event, source, data];
-						}
+	/**
+	 * Returns the handlers of a queue that can be notified about an event in priority order
+	 *
+	 * @param \SplPriorityQueue|array queue
+	 * @param string eventName
+	 * @return array
+	 */
+	protected function _compileQueue(var queue, string! eventName) -> array
+	{
+		var iterator, handler, handlers, className, hasMethod;
 
-						// Call the function in the PHP userland
-						let status = call_user_func_array(handler, arguments);
+		let handlers = [];
 
-						// Trace the response
-						if collect {
-							let this->_responses[] = status;
-						}
+		if typeof queue == "object" {
 
-						if cancelable {
+			// We need to clone the queue before iterate over it
+			let iterator = clone queue;
 
-							// Check if the event was stopped by the user
-							if event->isStopped() {
-								break;
-							}
-						}
+			// Move the queue to the top
+			iterator->top();
 
-					} else {
+			let queue = [];
+			while iterator->valid() {
+				let queue[] = iterator->current();
+				iterator->next();
+			}
+		}
 
-						// Check if the listener has implemented an event with the same name
-						if method_exists(handler, eventName) {
+		for handler in queue {
 
-							// Call the function in the PHP userland
-							let status = handler->{eventName}(event, source, data);
+			// Only handler objects are valid
+			if typeof handler != "object" {
+				continue;
+			}
 
-							// Collect the response
-							if collect {
-								let this->_responses[] = status;
-							}
+			// Closures receive every event
+			if handler instanceof \Closure {
+				let handlers[] = handler;
+				continue;
+			}
 
-							if cancelable {
+			// Check if the listener has implemented an event with the same name
+			let className = get_class(handler);
+			if !fetch hasMethod, this->_handlerMethods[className][eventName] {
+				let hasMethod = method_exists(handler, eventName),
+					this->_handlerMethods[className][eventName] = hasMethod;
+			}
 
-								// Check if the event was stopped by the user
-								if event->isStopped() {
-									break;
-								}
-							}
-						}
-					}
-				}
+			if hasMethod {
+				let handlers[] = handler;
 			}
 		}
 
-		return status;
+		return handlers;
 	}
 
 	/**
-	 * Fires an event in the events manager causing the active listeners to be notified about it
+	 * Notifies an event to a list of compiled handlers
 	 *
-	 *<code>
-	 *	$eventsManager->fire("db", $connection);
-	 *</code>
-	 *
-	 * @param string eventType
-	 * @param object source
-	 * @param mixed  data
-	 * @param boolean cancelable
+	 * @param array handlers
+	 * @param \Phalcon\Events\Event event
+	 * @param string eventName
 	 * @return mixed
 	 */
-	public function fire(string! eventType, source, data = null, boolean cancelable = true)
+	protected function _fireHandlers(array! handlers, <EventInterface> event, string! eventName)
 	{
-		var events, eventParts, type, eventName, event, status, fireEvents;
+		var status, arguments, data, source, handler;
+		boolean collect, cancelable;
 
-		let events = this->_events;
-		if typeof events != "array" {
-			return null;
-		}
+		let status = null, arguments = null;
 
-		// All valid events must have a colon separator
-		if !memstr(eventType, ":") {
-			throw new Exception("Invalid event type " . eventType);
-		}
+		// Get the object who triggered the event
+		let source = event->getSource();
 
-		let eventParts = explode(":", eventType),
-			type = eventParts[0],
-			eventName = eventParts[1];
+		// Get extra data passed to the event
+		let data = event->getData();
 
-		let status = null;
+		// Tell if the event is cancelable
+		let cancelable = (boolean) event->isCancelable();
 
-		// Responses must be traced?
-		if this->_collect {
-			let this->_responses = null;
-		}
+		// Responses need to be traced?
+		let collect = (boolean) this->_collect;
 
-		let event = null;
+		for handler in handlers {
 
-		// Check if events are grouped by type
-		if fetch fireEvents, events[type] {
+			// Check if the event is a closure
+			if handler instanceof \Closure {
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+				// Create the closure arguments
+				if arguments === null {
+					let arguments = [event, source, data];
+				}
 
-				// Create the event context
-				let event = new Event(eventName, source, data, cancelable);
+				// Call the function in the PHP userland
+				let status = call_user_func_array(handler, arguments);
+			} else {
 
-				// Call the events queue
-				let status = this->fireQueue(fireEvents, event);
+				// Call the function in the PHP userland
+				let status = handler->{eventName}(event, source, data);
 			}
-		}
 
-		// Check if there are listeners for the event type itself
-		if fetch fireEvents, events[eventType] {
+			// Collect the response
+			if collect {
+				let this->_responses[] = status;
+			}
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+			if cancelable {
 
-				// Create the event if it wasn't created before
-				if event === null {
-					let event = new Event(eventName, source, data, cancelable);
+				// Check if the event was stopped by the user
+				if event->isStopped() {
+					break;
 				}
-
-				// Call the events queue
-				let status = this->fireQueue(fireEvents, event);
 			}
 		}
 
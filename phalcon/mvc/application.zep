@@ -342,6 +342,17 @@ class Application extends BaseApplication
 						 */
 						if renderStatus !== false {
 
+							/**
+							 * Streaming views write to the output, so the headers are sent first
+							 */
+							if view instanceof View {
+								if view->isStreaming() {
+									let response = <ResponseInterface> dependencyInjector->getShared("response");
+									response->sendHeaders();
+									response->sendCookies();
+								}
+							}
+
 							/**
 							 * Automatic render based on the latest controller executed
 							 */
@@ -26,6 +26,7 @@ use Phalcon\DiInterface;
 use Phalcon\Mvc\Model\Message;
 use Phalcon\Mvc\Model\ResultInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Mvc\Model\Manager;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Mvc\Model\MetaDataInterface;
 use Phalcon\Mvc\Model\Criteria;
@@ -35,6 +36,7 @@ use Phalcon\Mvc\Model\CriteriaInterface;
 use Phalcon\Mvc\Model\TransactionInterface;
 use Phalcon\Mvc\Model\Resultset;
 use Phalcon\Mvc\Model\ResultsetInterface;
+use Phalcon\Mvc\Model\Resultset\Lazy;
 use Phalcon\Mvc\Model\Query;
 use Phalcon\Mvc\Model\Query\Builder;
 use Phalcon\Mvc\Model\Relation;
@@ -536,7 +538,26 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 */
 	public static function cloneResultMap(var base, array! data, var columnMap, int dirtyState = 0, boolean keepSnapshots = null) -> <Model>
 	{
-		var instance, attribute, key, value, castValue, attributeName;
+		var instance, attribute, key, value, castValue, attributeName, manager, primaryKey, id;
+
+		/**
+		 * Records already present in the identity map are returned as they are
+		 */
+		let manager = null;
+		if dirtyState == self::DIRTY_STATE_PERSISTENT && base instanceof Model {
+			let manager = base->getModelsManager();
+			if manager instanceof Manager && manager->getIdentityMapSize() > 0 {
+				let primaryKey = manager->getIdentityPrimaryKey(base);
+				if typeof primaryKey == "array" && fetch id, data[primaryKey[0]] {
+					let instance = manager->getIdentityRecord(get_class(base), id);
+					if typeof instance == "object" {
+						return instance;
+					}
+				}
+			} else {
+				let manager = null;
+			}
+		}
 
 		let instance = clone base;
 
@@ -624,6 +645,10 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			instance->{"fireEvent"}("afterFetch");
 		}
 
+		if manager !== null {
+			manager->setIdentityRecord(instance);
+		}
+
 		return instance;
 	}
 
@@ -793,11 +818,23 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 * foreach ($robots as $robot) {
 	 *	 echo $robot->name, "\n";
 	 * }
+	 *
+	 * // Export every robot fetching and hydrating one row at a time
+	 * $robots = Robots::find(
+	 *     [
+	 *         "order"  => "id",
+	 *         "stream" => true,
+	 *     ]
+	 * );
+	 *
+	 * foreach ($robots as $robot) {
+	 *	 echo $robot->name, "\n";
+	 * }
 	 * </code>
 	 */
 	public static function find(var parameters = null) -> <ResultsetInterface>
 	{
-		var params, builder, query, bindParams, bindTypes, cache, resultset, hydration, dependencyInjector, manager;
+		var params, builder, query, bindParams, bindTypes, cache, resultset, hydration, dependencyInjector, manager, stream;
 
 		let dependencyInjector = Di::getDefault();
 		let manager = <ManagerInterface> dependencyInjector->getShared("modelsManager");
@@ -842,6 +879,13 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			query->cache(cache);
 		}
 
+		/**
+		 * Fetch and hydrate the rows one at a time
+		 */
+		if fetch stream, params["stream"] {
+			query->setStream(stream);
+		}
+
 		/**
 		 * Execute the query passing the bind-params and casting-types
 		 */
@@ -859,6 +903,77 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		return resultset;
 	}
 
+	/**
+	 * Calls a function with the records that match the specified conditions in chunks ordered
+	 * by the primary key. Every chunk is fetched with a condition on the last primary key of the
+	 * previous one instead of an offset. Returning false from the function stops the iteration
+	 *
+	 * <code>
+	 * Robots::chunkById(
+	 *     [
+	 *         "type = 'mechanical'",
+	 *     ],
+	 *     500,
+	 *     function ($robots) {
+	 *         foreach ($robots as $robot) {
+	 *             echo $robot->name, "\n";
+	 *         }
+	 *     }
+	 * );
+	 * </code>
+	 *
+	 * @param string|array parameters
+	 * @param int size
+	 * @param callable callback
+	 * @return boolean
+	 */
+	public static function chunkById(var parameters, int size, var callback) -> boolean
+	{
+		var lazy, chunk;
+
+		if !is_callable(callback) {
+			throw new Exception("The callback must be callable");
+		}
+
+		let lazy = new Lazy(get_called_class(), parameters, size);
+
+		loop {
+			let chunk = lazy->nextChunk();
+			if typeof chunk != "object" {
+				break;
+			}
+
+			if call_user_func(callback, chunk) === false {
+				return false;
+			}
+
+			/**
+			 * Release the chunk before fetching the next one
+			 */
+			let chunk = null;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Returns an iterator over the records that match the specified conditions fetching them
+	 * in chunks ordered by the primary key
+	 *
+	 * <code>
+	 * foreach (Robots::lazy("type = 'mechanical'", 500) as $robot) {
+	 *     echo $robot->name, "\n";
+	 * }
+	 * </code>
+	 *
+	 * @param string|array parameters
+	 * @param int size
+	 */
+	public static function lazy(var parameters = null, int size = 1000) -> <Lazy>
+	{
+		return new Lazy(get_called_class(), parameters, size);
+	}
+
 	/**
 	 * Query the first record that matches the specified conditions
 	 *
@@ -892,11 +1007,21 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	public static function findFirst(var parameters = null) -> <Model>
 	{
 		var params, builder, query, bindParams, bindTypes, cache,
-			dependencyInjector, manager;
+			dependencyInjector, manager, record;
 
 		let dependencyInjector = Di::getDefault();
 		let manager = <ManagerInterface> dependencyInjector->getShared("modelsManager");
 
+		/**
+		 * Records searched by their primary key can be taken from the identity map
+		 */
+		if is_numeric(parameters) && manager instanceof Manager {
+			let record = manager->getIdentityRecord(get_called_class(), parameters);
+			if typeof record == "object" {
+				return record;
+			}
+		}
+
 		if typeof parameters != "array" {
 			let params = [];
 			if parameters !== null {
@@ -3353,6 +3478,13 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 			}
 		}
 
+		/**
+		 * Deleted records can't be returned by the identity map
+		 */
+		if success && this->_modelsManager instanceof Manager {
+			this->_modelsManager->removeIdentityRecord(this);
+		}
+
 		/**
 		 * Force perform the record existence checking again
 		 */
@@ -4569,7 +4701,8 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	{
 		var disableEvents, columnRenaming, notNullValidations,
 			exceptionOnFailedSave, phqlLiterals, virtualForeignKeys,
-			lateStateBinding, castOnHydrate, ignoreUnknownColumns;
+			lateStateBinding, castOnHydrate, ignoreUnknownColumns,
+			persistentAstCache, persistentAstCacheSize;
 
 		/**
 		 * Enables/Disables globally the internal events
@@ -4633,6 +4766,20 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		if fetch ignoreUnknownColumns, options["ignoreUnknownColumns"] {
 			globals_set("orm.ignore_unknown_columns", ignoreUnknownColumns);
 		}
+
+		/**
+		 * Enables/Disables the process-wide cache of parsed PHQL statements
+		 */
+		if fetch persistentAstCache, options["persistentAstCache"] {
+			globals_set("orm.persistent_ast_cache", persistentAstCache);
+		}
+
+		/**
+		 * Maximum number of statements kept in the process-wide PHQL cache
+		 */
+		if fetch persistentAstCacheSize, options["persistentAstCacheSize"] {
+			globals_set("orm.persistent_ast_cache_size", persistentAstCacheSize);
+		}
 	}
 
 	/**
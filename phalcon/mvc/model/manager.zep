@@ -26,6 +26,7 @@ use Phalcon\Mvc\Model\Exception;
 use Phalcon\Mvc\ModelInterface;
 use Phalcon\Db\AdapterInterface;
 use Phalcon\Mvc\Model\ResultsetInterface;
+use Phalcon\Mvc\Model\Resultset\Simple;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Events\EventsAwareInterface;
@@ -34,6 +35,7 @@ use Phalcon\Mvc\Model\QueryInterface;
 use Phalcon\Mvc\Model\Query\Builder;
 use Phalcon\Mvc\Model\Query\BuilderInterface;
 use Phalcon\Mvc\Model\BehaviorInterface;
+use Phalcon\Cache\BackendInterface;
 use Phalcon\Events\ManagerInterface as EventsManagerInterface;
 
 /**
@@ -155,6 +157,29 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 
 	protected _namespaceAliases;
 
+	/**
+	 * Cache of PHQL intermediate representations shared across requests
+	 */
+	protected _intermediateCache;
+
+	protected _intermediateCacheVersion = "";
+
+	/**
+	 * Records loaded in the current request indexed by model and primary key
+	 * in least recently used order
+	 */
+	protected _identityMap = [];
+
+	/**
+	 * Maximum number of records in the identity map, 0 disables it
+	 */
+	protected _identityMapSize = 0;
+
+	/**
+	 * Primary key column and attribute of every model, false for compound keys
+	 */
+	protected _identityPrimaryKeys = [];
+
 	/**
 	 * Sets the DependencyInjector container
 	 */
@@ -1203,7 +1228,8 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 		var placeholders, referencedModel, intermediateModel,
 			intermediateFields, joinConditions, fields, builder, extraParameters,
 			conditions, refPosition, field, referencedFields, findParams,
-			findArguments, retrieveMethod, uniqueKey, records, arguments, rows, firstRow;
+			findArguments, retrieveMethod, uniqueKey, records, arguments, rows, firstRow,
+			primaryKey;
 		boolean reusable;
 
 		/**
@@ -1344,6 +1370,21 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 
 		let arguments = [findParams];
 
+		/**
+		 * Records referenced by their primary key can be taken from the identity map
+		 */
+		if this->_identityMapSize > 0 && retrieveMethod === "findFirst" && parameters === null && extraParameters === null {
+			if relation->getType() == Relation::BELONGS_TO && typeof fields != "array" {
+				let primaryKey = this->getIdentityPrimaryKey(referencedModel);
+				if typeof primaryKey == "array" && primaryKey[1] == relation->getReferencedFields() {
+					let records = this->getIdentityRecord(referencedModel, record->readAttribute(fields));
+					if typeof records == "object" {
+						return records;
+					}
+				}
+			}
+		}
+
 		/**
 		 * Find first results could be reusable
 		 */
@@ -1372,6 +1413,285 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 		return records;
 	}
 
+	/**
+	 * Loads the related records of every record in a resultset using one query per relation
+	 * and assigns them to the records as if they were obtained through the relation alias.
+	 * Nested relations are separated by dots
+	 *
+	 *<code>
+	 * $robots = $modelsManager->eagerLoad(
+	 *     Robots::find(),
+	 *     [
+	 *         "robotsParts",
+	 *         "robotsParts.parts",
+	 *     ]
+	 * );
+	 *
+	 * foreach ($robots as $robot) {
+	 *     // No queries are executed here
+	 *     foreach ($robot->robotsParts as $robotPart) {
+	 *         echo $robotPart->parts->name, "\n";
+	 *     }
+	 * }
+	 *</code>
+	 *
+	 * @param \Phalcon\Mvc\Model\ResultsetInterface resultset
+	 * @param string|array relations
+	 * @return \Phalcon\Mvc\Model\ResultsetInterface
+	 */
+	public function eagerLoad(<ResultsetInterface> resultset, var relations) -> <ResultsetInterface>
+	{
+		var records, loaded, relationPath, parents, path, alias, childPath, children;
+
+		if !(resultset instanceof Simple) {
+			throw new Exception("Only resultsets of complete records can be eager loaded");
+		}
+
+		if resultset->getHydrateMode() != Resultset::HYDRATE_RECORDS {
+			throw new Exception("Eager loading requires the records hydration mode");
+		}
+
+		if typeof relations == "string" {
+			let relations = [relations];
+		}
+
+		if typeof relations != "array" {
+			throw new Exception("Relations to eager load must be an array or a string");
+		}
+
+		/**
+		 * Records must be the same instances when the resultset is traversed later
+		 */
+		let records = resultset->hydrate();
+
+		/**
+		 * Nested relations reuse the records loaded for their parents
+		 */
+		let loaded = [];
+
+		for relationPath in relations {
+
+			let parents = records,
+				path = "";
+
+			for alias in explode(".", relationPath) {
+
+				if path === "" {
+					let childPath = strtolower(alias);
+				} else {
+					let childPath = path . "." . strtolower(alias);
+				}
+
+				if !fetch children, loaded[childPath] {
+					let children = this->_eagerLoadRelation(parents, alias),
+						loaded[childPath] = children;
+				}
+
+				let parents = children,
+					path = childPath;
+			}
+		}
+
+		return resultset;
+	}
+
+	/**
+	 * Loads the records of a relation for a list of records of the same model
+	 * returning every related record loaded
+	 */
+	protected function _eagerLoadRelation(array! records, string! alias) -> array
+	{
+		var firstRecord, modelName, relation, fields, referencedFields, referencedModel,
+			intermediateModel, intermediateFields, intermediateReferencedFields,
+			lowerAlias, record, value, keys, queryKeys, groups, builder, rows, row,
+			partitions, related, children, relatedRecord, hash, params, batchParams, param;
+		boolean single;
+
+		if !fetch firstRecord, records[0] {
+			return [];
+		}
+
+		let modelName = get_class(firstRecord),
+			relation = <RelationInterface> this->getRelationByAlias(modelName, alias);
+		if typeof relation != "object" {
+			throw new Exception("There is no defined relations for the model '" . modelName . "' using alias '" . alias . "'");
+		}
+
+		let fields = relation->getFields(),
+			referencedFields = relation->getReferencedFields(),
+			referencedModel = relation->getReferencedModel();
+
+		if typeof fields == "array" || typeof referencedFields == "array" {
+			throw new Exception("Relations with multiple fields can't be eager loaded");
+		}
+
+		/**
+		 * The limits of a relation apply to every record, they can't be applied
+		 * to a single query, so these relations are loaded record by record
+		 */
+		let params = relation->getParams();
+		if typeof params == "array" {
+			if isset params["limit"] || isset params["offset"] {
+				return this->_eagerLoadEach(records, alias, relation);
+			}
+		}
+
+		/**
+		 * Collect the distinct values of the field on the records
+		 */
+		let keys = [];
+		for record in records {
+			let value = record->readAttribute(fields);
+			if value !== null {
+				let keys[value] = value;
+			}
+		}
+
+		if !count(keys) {
+			return [];
+		}
+
+		let groups = [];
+
+		if relation->isThrough() {
+
+			let intermediateModel = relation->getIntermediateModel(),
+				intermediateFields = relation->getIntermediateFields(),
+				intermediateReferencedFields = relation->getIntermediateReferencedFields();
+
+			if typeof intermediateFields == "array" || typeof intermediateReferencedFields == "array" {
+				throw new Exception("Relations with multiple fields can't be eager loaded");
+			}
+
+			/**
+			 * Map the records to the referenced keys through the intermediate model
+			 */
+			let builder = this->createBuilder();
+			builder->columns("[" . intermediateFields . "] AS eagerKey, [" . intermediateReferencedFields . "] AS eagerReferencedKey");
+			builder->from(intermediateModel);
+			builder->inWhere("[" . intermediateFields . "]", array_values(keys));
+
+			let rows = builder->getQuery()->execute(),
+				queryKeys = [];
+
+			for row in iterator_to_array(rows) {
+				let value = row->readAttribute("eagerReferencedKey"),
+					groups[row->readAttribute("eagerKey")][] = value,
+					queryKeys[value] = value;
+			}
+
+			if !count(queryKeys) {
+				return [];
+			}
+		} else {
+			let queryKeys = keys;
+			for value in keys {
+				let groups[value] = [value];
+			}
+		}
+
+		/**
+		 * Query the related records of every record at once, the order is kept
+		 * because the records of every parent keep their relative order
+		 */
+		let batchParams = [];
+		if typeof params == "array" {
+			for param in ["conditions", 0, "bind", "bindTypes", "columns", "order"] {
+				if fetch value, params[param] {
+					let batchParams[param] = value;
+				}
+			}
+		} elseif typeof params == "string" {
+			let batchParams[] = params;
+		}
+
+		let builder = this->createBuilder(batchParams);
+		builder->from(referencedModel);
+		builder->inWhere("[" . referencedModel . "].[" . referencedFields . "]", array_values(queryKeys));
+
+		let partitions = builder->getQuery()->execute()->partition(referencedFields, groups);
+
+		/**
+		 * Assign the related records to the same property the relation alias uses
+		 */
+		let lowerAlias = strtolower(alias),
+			single = relation->getType() == Relation::BELONGS_TO || relation->getType() == Relation::HAS_ONE;
+
+		for record in records {
+
+			let value = record->readAttribute(fields);
+			if value === null {
+				continue;
+			}
+
+			if !fetch related, partitions[value] {
+				continue;
+			}
+
+			if single {
+				let related = related->getFirst();
+				if typeof related != "object" {
+					continue;
+				}
+			}
+
+			let record->{lowerAlias} = related;
+		}
+
+		/**
+		 * Records related to several parents are returned once
+		 */
+		let children = [];
+		for related in partitions {
+			for relatedRecord in iterator_to_array(related) {
+				let hash = spl_object_hash(relatedRecord);
+				if !isset children[hash] {
+					let children[hash] = relatedRecord;
+				}
+			}
+		}
+
+		return array_values(children);
+	}
+
+	/**
+	 * Loads the records of a relation one record at a time, used for relations
+	 * whose limits must apply to every record
+	 */
+	protected function _eagerLoadEach(array! records, string! alias, <RelationInterface> relation) -> array
+	{
+		var lowerAlias, record, related, relatedRecord, children, hash;
+
+		let lowerAlias = strtolower(alias),
+			children = [];
+
+		for record in records {
+
+			let related = this->getRelationRecords(relation, null, record);
+			if typeof related != "object" {
+				continue;
+			}
+
+			let record->{lowerAlias} = related;
+
+			if related instanceof Simple {
+				/**
+				 * Nested relations are assigned to the same instances the resultset returns
+				 */
+				for relatedRecord in related->hydrate() {
+					let hash = spl_object_hash(relatedRecord);
+					if !isset children[hash] {
+						let children[hash] = relatedRecord;
+					}
+				}
+			} else {
+				let children[spl_object_hash(related)] = related;
+			}
+		}
+
+		return array_values(children);
+	}
+
 	/**
 	 * Returns a reusable object from the internal list
 	 */
@@ -1612,6 +1932,234 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
 		return false;
 	}
 
+	/**
+	 * Sets a cache backend used to keep the intermediate representation of
+	 * PHQL statements across requests. Every cached IR is stored with a hash of
+	 * the attributes, column maps and relations of the models it uses and it's
+	 * prepared again when they change. The optional version is added to the
+	 * keys to discard all the cached statements at once, e.g. on deploys.
+	 * Passing null disables the cache
+	 *
+	 * <code>
+	 * $modelsManager->setIntermediateCache(
+	 *     new \Phalcon\Cache\Backend\Apc(
+	 *         new \Phalcon\Cache\Frontend\Data(["lifetime" => 86400]),
+	 *         ["prefix" => "phql-"]
+	 *     ),
+	 *     $deployVersion
+	 * );
+	 * </code>
+	 */
+	public function setIntermediateCache(<BackendInterface> cache = null, string! version = "") -> <Manager>
+	{
+		let this->_intermediateCache = cache,
+			this->_intermediateCacheVersion = version;
+		return this;
+	}
+
+	/**
+	 * Returns the cache backend used to keep the PHQL intermediate representations
+	 */
+	public function getIntermediateCache() -> <BackendInterface>
+	{
+		return this->_intermediateCache;
+	}
+
+	/**
+	 * Returns the version added to the keys of the cached intermediate representations
+	 */
+	public function getIntermediateCacheVersion() -> string
+	{
+		return this->_intermediateCacheVersion;
+	}
+
+	/**
+	 * Enables the identity map keeping up to the given number of records, 0 disables it.
+	 * Records loaded by findFirst() with a primary key, belongsTo relations and the hydration
+	 * of resultsets are returned from the map instead of creating a new instance
+	 *
+	 * <code>
+	 * $modelsManager->setIdentityMapSize(5000);
+	 *
+	 * // Both variables reference the same instance
+	 * $robot = Robots::findFirst(1);
+	 * $same  = Robots::findFirst(1);
+	 * </code>
+	 */
+	public function setIdentityMapSize(int size) -> <Manager>
+	{
+		let this->_identityMapSize = size;
+
+		if size <= 0 {
+			let this->_identityMap = [];
+		} else {
+			while count(this->_identityMap) > size {
+				this->_evictIdentityRecord();
+			}
+		}
+
+		return this;
+	}
+
+	/**
+	 * Returns the maximum number of records in the identity map
+	 */
+	public function getIdentityMapSize() -> int
+	{
+		return this->_identityMapSize;
+	}
+
+	/**
+	 * Returns the column and the attribute of the primary key of a model or false
+	 * if the model doesn't have a single column primary key
+	 *
+	 * @param string|\Phalcon\Mvc\ModelInterface model
+	 * @return array|boolean
+	 */
+	public function getIdentityPrimaryKey(var model) -> array | boolean
+	{
+		var className, primaryKey, metaData, primaryKeys, column, attribute, columnMap;
+
+		if typeof model == "object" {
+			let className = get_class_lower(model);
+		} else {
+			let className = strtolower(model);
+		}
+
+		if fetch primaryKey, this->_identityPrimaryKeys[className] {
+			return primaryKey;
+		}
+
+		if typeof model != "object" {
+			let model = this->load(model);
+		}
+
+		let metaData = model->getModelsMetaData(),
+			primaryKeys = metaData->getPrimaryKeyAttributes(model);
+
+		if count(primaryKeys) != 1 {
+			let this->_identityPrimaryKeys[className] = false;
+			return false;
+		}
+
+		let column = primaryKeys[0],
+			attribute = column;
+
+		if globals_get("orm.column_renaming") {
+			let columnMap = metaData->getColumnMap(model);
+			if typeof columnMap == "array" {
+				fetch attribute, columnMap[column];
+			}
+		}
+
+		let primaryKey = [column, attribute],
+			this->_identityPrimaryKeys[className] = primaryKey;
+
+		return primaryKey;
+	}
+
+	/**
+	 * Returns the record of a model with the given primary key from the identity map
+	 * or false if it isn't loaded
+	 */
+	public function getIdentityRecord(string! modelName, var id) -> <ModelInterface> | boolean
+	{
+		var key, record;
+
+		if this->_identityMapSize <= 0 || !is_scalar(id) {
+			return false;
+		}
+
+		let key = strtolower(modelName) . "-" . id;
+		if !fetch record, this->_identityMap[key] {
+			return false;
+		}
+
+		/**
+		 * Move the record to the end of the list, it's now the most recently used
+		 */
+		unset this->_identityMap[key];
+		let this->_identityMap[key] = record;
+
+		return record;
+	}
+
+	/**
+	 * Stores a record in the identity map
+	 */
+	public function setIdentityRecord(<ModelInterface> record) -> void
+	{
+		var primaryKey, id, key;
+
+		if this->_identityMapSize <= 0 {
+			return;
+		}
+
+		let primaryKey = this->getIdentityPrimaryKey(record);
+		if typeof primaryKey != "array" {
+			return;
+		}
+
+		let id = record->readAttribute(primaryKey[1]);
+		if !is_scalar(id) {
+			return;
+		}
+
+		let key = get_class_lower(record) . "-" . id;
+
+		unset this->_identityMap[key];
+
+		while count(this->_identityMap) >= this->_identityMapSize {
+			this->_evictIdentityRecord();
+		}
+
+		let this->_identityMap[key] = record;
+	}
+
+	/**
+	 * Removes a record from the identity map
+	 */
+	public function removeIdentityRecord(<ModelInterface> record) -> void
+	{
+		var primaryKey, id;
+
+		if this->_identityMapSize <= 0 {
+			return;
+		}
+
+		let primaryKey = this->getIdentityPrimaryKey(record);
+		if typeof primaryKey != "array" {
+			return;
+		}
+
+		let id = record->readAttribute(primaryKey[1]);
+		if is_scalar(id) {
+			unset this->_identityMap[get_class_lower(record) . "-" . id];
+		}
+	}
+
+	/**
+	 * Removes every record from the identity map
+	 */
+	public function clearIdentityMap() -> void
+	{
+		let this->_identityMap = [];
+	}
+
+	/**
+	 * Removes the least recently used record from the identity map
+	 */
+	protected function _evictIdentityRecord() -> void
+	{
+		var key, record;
+
+		for key, record in this->_identityMap {
+			break;
+		}
+
+		unset this->_identityMap[key];
+	}
+
 	/**
 	 * Creates a Phalcon\Mvc\Model\Query without execute it
 	 */
@@ -56,6 +56,28 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
 
 	protected _columnMap;
 
+	/**
+	 * Whether the meta-data is loaded from a snapshot
+	 */
+	protected _useSnapshot = false;
+
+	/**
+	 * File where the snapshot is stored, the adapter is used if it's null
+	 */
+	protected _snapshotPath;
+
+	/**
+	 * Whether models missing in the snapshot throw an exception
+	 */
+	protected _snapshotStrict = false;
+
+	protected _snapshotLoaded = false;
+
+	/**
+	 * Whether the meta-data is being rebuilt without reading the adapter
+	 */
+	protected _warmingUp = false;
+
 	const MODELS_ATTRIBUTES = 0;
 
 	const MODELS_PRIMARY_KEY = 1;
@@ -88,6 +110,8 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
 
 	const MODELS_REVERSE_COLUMN_MAP = 1;
 
+	const SNAPSHOT_VERSION = 1;
+
 	/**
 	 * Initialize the metadata for certain table
 	 */
@@ -99,16 +123,32 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
 		let strategy = null,
 			className = get_class(model);
 
+		/**
+		 * The snapshot is read once, with a single read
+		 */
+		if this->_useSnapshot && !this->_snapshotLoaded {
+			this->_loadSnapshot();
+		}
+
 		if key !== null {
 
 			let metaData = this->_metaData;
 			if !isset metaData[key] {
 
+				if this->_snapshotStrict {
+					throw new Exception("The meta-data of model " . className . " isn't in the snapshot");
+				}
+
 				/**
 				 * The meta-data is read from the adapter always if not available in _metaData property
 				 */
-				let prefixKey = "meta-" . key,
-					data = this->{"read"}(prefixKey);
+				let prefixKey = "meta-" . key;
+				if this->_warmingUp {
+					let data = null;
+				} else {
+					let data = this->{"read"}(prefixKey);
+				}
+
 				if data !== null {
 					let this->_metaData[key] = data;
 				} else {
@@ -156,12 +196,20 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
 			return null;
 		}
 
+		if this->_snapshotStrict {
+			throw new Exception("The column map of model " . className . " isn't in the snapshot");
+		}
+
 		/**
 		 * Create the map key name
 		 * Check if the meta-data is already in the adapter
 		 */
-		let prefixKey = "map-" . keyName,
-			data = this->{"read"}(prefixKey);
+		let prefixKey = "map-" . keyName;
+		if this->_warmingUp {
+			let data = null;
+		} else {
+			let data = this->{"read"}(prefixKey);
+		}
 
 		if data !== null {
 			let this->_columnMap[keyName] = data;
@@ -776,6 +824,247 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
 	public function reset() -> void
 	{
 		let this->_metaData = [],
-			this->_columnMap = [];
+			this->_columnMap = [],
+			this->_snapshotLoaded = false;
+	}
+
+	/**
+	 * Loads the meta-data of every model from a snapshot generated by
+	 * Phalcon\Mvc\Model\MetaData::warmUp(), with a single read instead of
+	 * two reads per model. If a path is passed the snapshot is a PHP file
+	 * that can be cached by opcache, otherwise it's read from the adapter.
+	 * In strict mode models missing in the snapshot throw an exception
+	 * instead of being introspected
+	 *
+	 *<code>
+	 * $metaData->useSnapshot("app/cache/metadata.php", true);
+	 *</code>
+	 */
+	public function useSnapshot(string path = null, boolean strict = false) -> <MetaData>
+	{
+		let this->_useSnapshot = true,
+			this->_snapshotPath = path,
+			this->_snapshotStrict = false,
+			this->_snapshotLoaded = false;
+
+		if strict {
+			this->_loadSnapshot();
+			let this->_snapshotStrict = true;
+		}
+
+		return this;
+	}
+
+	/**
+	 * Returns the meta-data currently loaded as a snapshot
+	 */
+	public function getSnapshot() -> array
+	{
+		return [
+			"version":   self::SNAPSHOT_VERSION,
+			"renaming":  (bool) globals_get("orm.column_renaming"),
+			"metaData":  this->_metaData,
+			"columnMap": this->_columnMap
+		];
+	}
+
+	/**
+	 * Adds the meta-data of a snapshot, returns false if it isn't valid or
+	 * was generated with a different format or column renaming setting
+	 */
+	public function importSnapshot(var snapshot) -> boolean
+	{
+		var version, renaming, metaData, columnMap;
+
+		if typeof snapshot != "array" {
+			return false;
+		}
+
+		if !fetch version, snapshot["version"] {
+			return false;
+		}
+
+		if !fetch renaming, snapshot["renaming"] {
+			return false;
+		}
+
+		if !fetch metaData, snapshot["metaData"] {
+			return false;
+		}
+
+		if !fetch columnMap, snapshot["columnMap"] {
+			return false;
+		}
+
+		if version != self::SNAPSHOT_VERSION || renaming != (bool) globals_get("orm.column_renaming") {
+			return false;
+		}
+
+		if typeof metaData != "array" || typeof columnMap != "array" {
+			return false;
+		}
+
+		if typeof this->_metaData == "array" {
+			let metaData = array_merge(metaData, this->_metaData);
+		}
+
+		if typeof this->_columnMap == "array" {
+			let columnMap = array_merge(columnMap, this->_columnMap);
+		}
+
+		let this->_metaData = metaData,
+			this->_columnMap = columnMap;
+
+		return true;
+	}
+
+	/**
+	 * Rebuilds the meta-data of a list of models, or of the models in a
+	 * directory, using the strategy and stores it as a snapshot. It's meant
+	 * to be run at deploy time, see Phalcon\Mvc\Model\MetaData\WarmUpTask
+	 *
+	 *<code>
+	 * $metaData->useSnapshot("app/cache/metadata.php");
+	 *
+	 * $metaData->warmUp("app/models/", "App\\Models\\");
+	 *</code>
+	 *
+	 * @param array|string models
+	 */
+	public function warmUp(var models, string namespaceName = null) -> array
+	{
+		var className, model, snapshot, strict, e;
+
+		if typeof models == "string" {
+			let models = this->_getModelsFromDirectory(models, (string) namespaceName);
+		}
+
+		if typeof models != "array" {
+			throw new Exception("Models must be an array of class names or a directory");
+		}
+
+		let strict = this->_snapshotStrict;
+
+		this->reset();
+
+		/**
+		 * The previous snapshot and the adapter are ignored while rebuilding
+		 */
+		let this->_warmingUp = true,
+			this->_snapshotStrict = false,
+			this->_snapshotLoaded = true;
+
+		try {
+			for className in models {
+				if typeof className == "object" {
+					let model = className;
+				} else {
+					let model = new {className}(null, this->_dependencyInjector);
+				}
+				this->readMetaData(model);
+				this->readColumnMap(model);
+			}
+		} catch \Exception, e {
+			let this->_warmingUp = false,
+				this->_snapshotStrict = strict;
+			throw e;
+		}
+
+		let this->_warmingUp = false,
+			this->_snapshotStrict = strict;
+
+		let snapshot = this->getSnapshot();
+
+		this->_saveSnapshot(snapshot);
+
+		return snapshot;
+	}
+
+	/**
+	 * Reads the snapshot from its file or the adapter
+	 */
+	protected function _loadSnapshot() -> boolean
+	{
+		var path, snapshot;
+
+		let this->_snapshotLoaded = true,
+			path = this->_snapshotPath;
+
+		if typeof path == "string" {
+			if !file_exists(path) {
+				return false;
+			}
+			let snapshot = require path;
+		} else {
+			let snapshot = this->{"read"}("snapshot");
+		}
+
+		return this->importSnapshot(snapshot);
+	}
+
+	/**
+	 * Writes the snapshot to its file or the adapter
+	 */
+	protected function _saveSnapshot(array! snapshot) -> void
+	{
+		var path, temporary;
+
+		let path = this->_snapshotPath;
+
+		if typeof path != "string" {
+			this->{"write"}("snapshot", snapshot);
+			return;
+		}
+
+		/**
+		 * The file is replaced atomically so requests never include a partial snapshot
+		 */
+		let temporary = path . "." . uniqid("", true);
+		if file_put_contents(temporary, "<?php return " . var_export(snapshot, true) . "; ") === false {
+			throw new Exception("Meta-Data snapshot cannot be written");
+		}
+
+		if !rename(temporary, path) {
+			unlink(temporary);
+			throw new Exception("Meta-Data snapshot cannot be written");
+		}
+	}
+
+	/**
+	 * Returns the instantiable models in a directory and its subdirectories
+	 */
+	protected function _getModelsFromDirectory(string! directory, string! namespaceName) -> array
+	{
+		var models, file, className, reflection, subDirectory;
+
+		let directory = rtrim(directory, "\\/") . DIRECTORY_SEPARATOR,
+			models = [];
+
+		if namespaceName !== "" {
+			let namespaceName = rtrim(namespaceName, "\\") . "\\";
+		}
+
+		for file in glob(directory . "*.php") {
+			let className = namespaceName . basename(file, ".php");
+			if !class_exists(className) {
+				continue;
+			}
+			if !is_subclass_of(className, "Phalcon\\Mvc\\ModelInterface") {
+				continue;
+			}
+			let reflection = new \ReflectionClass(className);
+			if reflection->isInstantiable() {
+				let models[] = className;
+			}
+		}
+
+		for subDirectory in glob(directory . "*", GLOB_ONLYDIR) {
+			let models = array_merge(
+				models,
+				this->_getModelsFromDirectory(subDirectory, namespaceName . basename(subDirectory))
+			);
+		}
+
+		return models;
 	}
 }
@@ -0,0 +1,64 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Mvc\Model\MetaData;
+
+use Phalcon\Cli\Task;
+use Phalcon\Mvc\Model\Exception;
+
+/**
+ * Phalcon\Mvc\Model\MetaData\WarmUpTask
+ *
+ * Command-line task that rebuilds the meta-data snapshot of the models in
+ * a directory using the "modelsMetadata" service. It's meant to be run at
+ * deploy time so the strategy never introspects the tables in production.
+ *
+ *<code>
+ * php cli.php 'Phalcon\Mvc\Model\MetaData\WarmUp' main app/models/ 'App\Models' app/cache/metadata.php
+ *</code>
+ */
+class WarmUpTask extends Task
+{
+
+	/**
+	 * Expects the models directory, their namespace and the path of the snapshot
+	 */
+	public function mainAction(array params = []) -> void
+	{
+		var directory, namespaceName, path, metaData, snapshot;
+
+		if !fetch directory, params[0] {
+			throw new Exception("The models directory is required");
+		}
+
+		if !fetch namespaceName, params[1] {
+			let namespaceName = "";
+		}
+
+		let metaData = this->getDI()->getShared("modelsMetadata");
+
+		if fetch path, params[2] {
+			metaData->useSnapshot(path);
+		}
+
+		let snapshot = metaData->warmUp(directory, namespaceName);
+
+		echo "Meta-data of " . count(snapshot["metaData"]) . " models written", PHP_EOL;
+	}
+}
@@ -28,6 +28,7 @@ use Phalcon\Mvc\ModelInterface;
 use Phalcon\Mvc\Model\Exception;
 use Phalcon\Mvc\Model\ManagerInterface;
 use Phalcon\Mvc\Model\QueryInterface;
+use Phalcon\Cache\Backend;
 use Phalcon\Cache\BackendInterface;
 use Phalcon\Mvc\Model\Query\Status;
 use Phalcon\Mvc\Model\Resultset\Complex;
@@ -105,6 +106,12 @@ class Query implements QueryInterface, InjectionAwareInterface
 
 	protected _sharedLock;
 
+	protected _stream = false;
+
+	protected _with;
+
+	protected _preparedModels;
+
 	static protected _irPhqlCache;
 
 	const TYPE_SELECT = 309;
@@ -923,7 +930,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 			throw new Exception("Corrupted SELECT AST");
 		}
 
-		let model = manager->load(modelName),
+		let model = this->_loadPrepared(manager, modelName),
 			source = model->getSource(),
 			schema = model->getSchema();
 
@@ -955,7 +962,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 					let realModelName = modelName;
 				}
 
-				let model = manager->load(realModelName, true),
+				let model = this->_loadPrepared(manager, realModelName, true),
 					source = model->getSource(),
 					schema = model->getSchema();
 
@@ -1145,7 +1152,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 		/**
 		 * Get the intermediate model instance
 		 */
-		let intermediateModel = manager->load(intermediateModelName);
+		let intermediateModel = this->_loadPrepared(manager, intermediateModelName);
 
 		/**
 		 * Source of the related model
@@ -1829,7 +1836,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 			}
 
 			// Load a model instance from the models manager
-			let model = manager->load(realModelName, true);
+			let model = this->_loadPrepared(manager, realModelName, true);
 
 			// Define a complete schema/source
 			let schema = model->getSchema(),
@@ -2119,7 +2126,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 			let realModelName = modelName;
 		}
 
-		let model = manager->load(realModelName, true),
+		let model = this->_loadPrepared(manager, realModelName, true),
 			source = model->getSource(),
 			schema = model->getSchema();
 
@@ -2234,7 +2241,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 			/**
 			 * Load a model instance from the models manager
 			 */
-			let model = manager->load(realModelName, true),
+			let model = this->_loadPrepared(manager, realModelName, true),
 				source = model->getSource(),
 				schema = model->getSchema();
 
@@ -2370,7 +2377,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 			/**
 			 * Load a model instance from the models manager
 			 */
-			let model = manager->load(realModelName, true),
+			let model = this->_loadPrepared(manager, realModelName, true),
 				source = model->getSource(),
 				schema = model->getSchema();
 
@@ -2426,7 +2433,8 @@ class Query implements QueryInterface, InjectionAwareInterface
 	 */
 	public function parse() -> array
 	{
-		var intermediate, phql, ast, irPhql, uniqueId, type;
+		var intermediate, phql, ast, irPhql, uniqueId, type, manager,
+			intermediateCache, intermediateKey, cached, models, fingerprint;
 
 		let intermediate = this->_intermediate;
 		if typeof intermediate == "array" {
@@ -2439,7 +2447,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 		let phql = this->_phql,
 			ast = phql_parse_phql(phql);
 
-		let irPhql = null, uniqueId = null;
+		let irPhql = null, uniqueId = null, intermediateCache = null;
 
 		if typeof ast == "array" {
 
@@ -2457,13 +2465,56 @@ class Query implements QueryInterface, InjectionAwareInterface
 				}
 			}
 
+			/**
+			 * Check if the IR was prepared by a previous request
+			 */
+			let manager = this->_manager;
+
+			if manager instanceof Manager {
+				let intermediateCache = manager->getIntermediateCache();
+				if typeof intermediateCache == "object" {
+					let intermediateKey = "phql-" . md5(
+						manager->getIntermediateCacheVersion() . ":" . intval(this->_enableImplicitJoins) . ":" . phql
+					);
+
+					/**
+					 * The cached IR is only used if the metadata and relations
+					 * of the models it was prepared with didn't change
+					 */
+					let cached = intermediateCache->get(intermediateKey);
+					if typeof cached == "array" {
+						if fetch models, cached["models"] {
+							if fetch fingerprint, cached["fingerprint"] {
+								if fetch irPhql, cached["intermediate"] {
+									if typeof models == "array" && typeof irPhql == "array" {
+										if fingerprint === this->_getModelsFingerprint(models) {
+											let this->_type = ast["type"];
+
+											if typeof uniqueId == "int" {
+												let self::_irPhqlCache[uniqueId] = irPhql;
+											}
+
+											let this->_intermediate = irPhql;
+											return irPhql;
+										}
+									}
+								}
+							}
+						}
+					}
+
+					let irPhql = null;
+				}
+			}
+
 			/**
 			 * A valid AST must have a type
 			 */
 			if fetch type, ast["type"] {
 
 				let this->_ast = ast,
-					this->_type = type;
+					this->_type = type,
+					this->_preparedModels = [];
 
 				switch type {
 
@@ -2500,6 +2551,18 @@ class Query implements QueryInterface, InjectionAwareInterface
 			let self::_irPhqlCache[uniqueId] = irPhql;
 		}
 
+		/**
+		 * Store the prepared AST in the cross-request cache
+		 */
+		if typeof intermediateCache == "object" {
+			let models = array_keys(this->_preparedModels);
+			intermediateCache->save(intermediateKey, [
+				"models":       models,
+				"fingerprint":  this->_getModelsFingerprint(models),
+				"intermediate": irPhql
+			]);
+		}
+
 		let this->_intermediate = irPhql;
 		return irPhql;
 	}
@@ -2755,15 +2818,30 @@ class Query implements QueryInterface, InjectionAwareInterface
 		/**
 		 * Execute the query
 		 */
-		let result = connection->query(sqlSelect, processed, processedTypes);
+		if this->_stream {
+
+			/**
+			 * Streaming resultsets read the rows from an unbuffered cursor if the adapter supports it.
+			 * Counting the rows would consume the cursor, so the result is always passed
+			 */
+			if method_exists(connection, "queryUnbuffered") {
+				let result = connection->{"queryUnbuffered"}(sqlSelect, processed, processedTypes);
+			} else {
+				let result = connection->query(sqlSelect, processed, processedTypes);
+			}
 
-		/**
-		 * Check if the query has data
-		 */
-		if result->numRows(result) {
 			let resultData = result;
 		} else {
-			let resultData = false;
+			let result = connection->query(sqlSelect, processed, processedTypes);
+
+			/**
+			 * Check if the query has data
+			 */
+			if result->numRows(result) {
+				let resultData = result;
+			} else {
+				let resultData = false;
+			}
 		}
 
 		/**
@@ -2836,20 +2914,20 @@ class Query implements QueryInterface, InjectionAwareInterface
 						throw new Exception("Resultset class \"" . resultsetClassName . "\" must be an implementation of Phalcon\\Mvc\\Model\\ResultsetInterface");
 					}
 
-					return new {resultsetClassName}(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots);
+					return new {resultsetClassName}(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots, this->_stream);
 				}
 			}
 
 			/**
 			 * Simple resultsets contains only complete objects
 			 */
-			return new Simple(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots);
+			return new Simple(simpleColumnMap, resultObject, resultData, cache, isKeepingSnapshots, this->_stream);
 		}
 
 		/**
 		 * Complex resultsets may contain complete objects and scalars
 		 */
-		return new Complex(columns1, resultData, cache);
+		return new Complex(columns1, resultData, cache, this->_stream);
 	}
 
 	/**
@@ -3304,9 +3382,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 	 */
 	public function execute(var bindParams = null, var bindTypes = null)
 	{
-		var uniqueRow, cacheOptions, key, cacheService,
-			cache, result, preparedResult, defaultBindParams, mergedParams,
-			defaultBindTypes, mergedTypes, type, lifetime, intermediate;
+		var uniqueRow, cacheOptions, key, cacheService, cache, result, lifetime;
 
 		let uniqueRow = this->_uniqueRow;
 
@@ -3320,6 +3396,10 @@ class Query implements QueryInterface, InjectionAwareInterface
 			/**
 			 * The user must set a cache key
 			 */
+			if this->_stream {
+				throw new Exception("Streaming resultsets can't be cached");
+			}
+
 			if !fetch key, cacheOptions["key"] {
 				throw new Exception("A cache key must be provided to identify the cached resultset in the cache backend");
 			}
@@ -3343,30 +3423,71 @@ class Query implements QueryInterface, InjectionAwareInterface
 				throw new Exception("Cache service must be an object");
 			}
 
-			let result = cache->get(key, lifetime);
-			if result !== null {
+			let this->_cache = cache;
+
+			if cache instanceof Backend {
+
+				/**
+				 * Only one worker executes the statement when the resultset expires
+				 */
+				let result = cache->remember(key, lifetime, [this, "executeUncached"], [bindParams, bindTypes]);
 
 				if typeof result != "object" {
 					throw new Exception("Cache didn't return a valid resultset");
 				}
 
-				result->setIsFresh(false);
+				if !cache->isFresh() {
+					result->setIsFresh(false);
+				}
+
+			} else {
+
+				let result = cache->get(key, lifetime);
+				if result !== null {
+
+					if typeof result != "object" {
+						throw new Exception("Cache didn't return a valid resultset");
+					}
+
+					result->setIsFresh(false);
 
-				/**
-				 * Check if only the first row must be returned
-				 */
-				if uniqueRow {
-					let preparedResult = result->getFirst();
 				} else {
-					let preparedResult = result;
-				}
 
-				return preparedResult;
+					let result = this->executeUncached(bindParams, bindTypes);
+
+					/**
+					 * We store the resultset in the cache
+					 */
+					cache->save(key, result, lifetime);
+				}
 			}
 
-			let this->_cache = cache;
+		} else {
+			let result = this->executeUncached(bindParams, bindTypes);
+		}
+
+		/**
+		 * Check if only the first row must be returned
+		 */
+		if uniqueRow {
+			return result->getFirst();
 		}
 
+		return result;
+	}
+
+	/**
+	 * Executes a parsed PHQL statement without reading or writing the cache
+	 *
+	 * @param array bindParams
+	 * @param array bindTypes
+	 * @return mixed
+	 */
+	public function executeUncached(var bindParams = null, var bindTypes = null)
+	{
+		var result, defaultBindParams, mergedParams, defaultBindTypes, mergedTypes,
+			type, intermediate, with, manager;
+
 		/**
 		 * The statement is parsed from its PHQL string or a previously processed IR
 		 */
@@ -3432,30 +3553,31 @@ class Query implements QueryInterface, InjectionAwareInterface
 		}
 
 		/**
-		 * We store the resultset in the cache if any
+		 * Load the related records of the whole resultset with one query per relation
 		 */
-		if cacheOptions !== null {
+		let with = this->_with;
+		if !empty with && type == PHQL_T_SELECT {
 
-			/**
-			 * Only PHQL SELECTs can be cached
-			 */
-			if type != PHQL_T_SELECT {
-				throw new Exception("Only PHQL statements that return resultsets can be cached");
+			if this->_stream {
+				throw new Exception("Streaming resultsets can't be eager loaded");
+			}
+
+			let manager = this->_manager;
+			if !(manager instanceof Manager) {
+				throw new Exception("Eager loading requires Phalcon\\Mvc\\Model\\Manager as models manager");
 			}
 
-			cache->save(key, result, lifetime);
+			manager->eagerLoad(result, with);
 		}
 
 		/**
-		 * Check if only the first row must be returned
+		 * Only PHQL SELECTs can be cached
 		 */
-		if uniqueRow {
-			let preparedResult = result->getFirst();
-		} else {
-			let preparedResult = result;
+		if this->_cacheOptions !== null && type != PHQL_T_SELECT {
+			throw new Exception("Only PHQL statements that return resultsets can be cached");
 		}
 
-		return preparedResult;
+		return result;
 	}
 
 	/**
@@ -3546,6 +3668,65 @@ class Query implements QueryInterface, InjectionAwareInterface
 		return this;
 	}
 
+	/**
+	 * Tells to the query if the rows of the resultset must be fetched and hydrated one at a time
+	 * from an unbuffered cursor. Streaming resultsets can only be traversed forward once, they
+	 * can't be counted, cached or exported to an array
+	 *
+	 *<code>
+	 * $robots = $manager->createQuery("SELECT * FROM Robots ORDER BY id")
+	 *     ->setStream(true)
+	 *     ->execute();
+	 *
+	 * foreach ($robots as $robot) {
+	 *     echo $robot->name, "\n";
+	 * }
+	 *</code>
+	 */
+	public function setStream(boolean stream = true) -> <Query>
+	{
+		let this->_stream = stream;
+
+		return this;
+	}
+
+	/**
+	 * Check if the query returns streaming resultsets
+	 */
+	public function isStream() -> boolean
+	{
+		return this->_stream;
+	}
+
+	/**
+	 * Sets the relations whose records are loaded for the whole resultset at once,
+	 * nested relations are separated by dots
+	 *
+	 *<code>
+	 * $robots = $manager->createQuery("SELECT * FROM Robots")
+	 *     ->setWith(["robotsParts", "robotsParts.parts"])
+	 *     ->execute();
+	 *</code>
+	 *
+	 * @param string|array with
+	 */
+	public function setWith(var with) -> <Query>
+	{
+		let this->_with = with;
+
+		return this;
+	}
+
+	/**
+	 * Returns the relations to eager load
+	 *
+	 * @return string|array
+	 */
+	public function getWith()
+	{
+		return this->_with;
+	}
+
 	/**
 	 * Set SHARED LOCK clause
 	 */
@@ -3630,4 +3811,57 @@ class Query implements QueryInterface, InjectionAwareInterface
 	{
 		let self::_irPhqlCache = [];
 	}
+
+	/**
+	 * Loads a model used to prepare the statement, keeping its name to
+	 * validate the intermediate representation kept across requests
+	 */
+	protected function _loadPrepared(<ManagerInterface> manager, string! modelName, boolean newInstance = false) -> <ModelInterface>
+	{
+		let this->_preparedModels[modelName] = true;
+		return manager->load(modelName, newInstance);
+	}
+
+	/**
+	 * Returns a hash of the attributes, column maps and relations of the
+	 * given models. An empty string is returned if a model can't be loaded
+	 */
+	protected function _getModelsFingerprint(array! models) -> string
+	{
+		var manager, metaData, modelName, model, relations, relation,
+			fingerprint, e;
+
+		let manager = this->_manager,
+			metaData = this->_metaData,
+			fingerprint = [];
+
+		try {
+			for modelName in models {
+				let model = manager->load(modelName),
+					relations = [];
+
+				for relation in array_merge(manager->getRelations(modelName), manager->getHasManyToMany(model)) {
+					let relations[] = [
+						relation->getType(),
+						relation->getFields(),
+						relation->getReferencedModel(),
+						relation->getReferencedFields(),
+						relation->getIntermediateModel(),
+						relation->getIntermediateFields(),
+						relation->getIntermediateReferencedFields()
+					];
+				}
+
+				let fingerprint[modelName] = [
+					metaData->getAttributes(model),
+					metaData->getColumnMap(model),
+					relations
+				];
+			}
+		} catch \Exception, e {
+			return "";
+		}
+
+		return md5(serialize(fingerprint));
+	}
 }
@@ -314,6 +314,36 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 	 	return this;
 	 }
 
+	/**
+	 * Sets the relations of the model whose records are loaded for the whole resultset at once
+	 *
+	 *<code>
+	 * $builder->with(
+	 *     [
+	 *         "robotsParts",
+	 *         "robotsParts.parts",
+	 *     ]
+	 * );
+	 *</code>
+	 *
+	 * @param string|array with
+	 */
+	public function with(var with) -> <Builder>
+	{
+		let this->_with = with;
+		return this;
+	}
+
+	/**
+	 * Returns the relations to eager load
+	 *
+	 * @return string|array
+	 */
+	public function getWith()
+	{
+		return this->_with;
+	}
+
 	/**
 	 * Returns SELECT DISTINCT / SELECT ALL flag
 	 */
@@ -1384,6 +1414,13 @@ class Builder implements BuilderInterface, InjectionAwareInterface
 			query->setSharedLock(this->_sharedLock);
 		}
 
+		/**
+		 * Pass the relations to eager load
+		 */
+		if !empty this->_with {
+			query->{"setWith"}(this->_with);
+		}
+
 		return query;
 	}
 
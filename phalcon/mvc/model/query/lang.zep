@@ -35,6 +35,11 @@ namespace Phalcon\Mvc\Model\Query;
  * <code>
  * $intermediate = Phalcon\Mvc\Model\Query\Lang::parsePHQL("SELECT r.* FROM Robots r LIMIT 10");
  * </code>
+ *
+ * Parsed statements are cached for the current request. With the
+ * "persistentAstCache" ORM option the ASTs are also kept in a process-wide
+ * LRU cache so every statement is parsed once per worker instead of
+ * once per request (not available in thread-safe builds).
  */
 abstract class Lang
 {
@@ -49,4 +54,27 @@ abstract class Lang
 	{
 		return phql_parse_phql(phql);
 	}
+
+	/**
+	 * Returns the counters of the process-wide AST cache enabled by the
+	 * "persistentAstCache" option in Phalcon\Mvc\Model::setup()
+	 *
+	 *<code>
+	 * $stats = Phalcon\Mvc\Model\Query\Lang::getCacheStats();
+	 *
+	 * echo $stats["hits"], " ", $stats["misses"];
+	 *</code>
+	 */
+	public static function getCacheStats() -> array
+	{
+		return phalcon_orm_ast_cache_stats();
+	}
+
+	/**
+	 * Removes every statement from the process-wide AST cache
+	 */
+	public static function clearCache() -> void
+	{
+		phalcon_orm_ast_cache_clear();
+	}
 }
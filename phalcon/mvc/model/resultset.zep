@@ -66,6 +66,18 @@ use Phalcon\Mvc\Model\ResultsetInterface;
  *
  *     $robots->next();
  * }
+ *
+ * // Streaming a huge resultset, rows are fetched and hydrated one at a time
+ * $robots = Robots::find(
+ *     [
+ *         "order"  => "id",
+ *         "stream" => true,
+ *     ]
+ * );
+ *
+ * foreach ($robots as $robot) {
+ *     echo $robot->name, "\n";
+ * }
  * </code>
  */
 abstract class Resultset
@@ -95,6 +107,11 @@ abstract class Resultset
 
 	protected _hydrateMode = 0;
 
+	/**
+	 * Streaming resultsets fetch rows one at a time and can only move forward
+	 */
+	protected _stream = false;
+
 	const TYPE_RESULT_FULL = 0;
 
 	const TYPE_RESULT_PARTIAL = 1;
@@ -108,13 +125,26 @@ abstract class Resultset
 	/**
 	 * Phalcon\Mvc\Model\Resultset constructor
 	 *
-	 * @param \Phalcon\Db\ResultInterface|false result
+	 * @param \Phalcon\Db\ResultInterface|array|false result
 	 * @param \Phalcon\Cache\BackendInterface cache
+	 * @param boolean stream
 	 */
-	public function __construct(result, <BackendInterface> cache = null)
+	public function __construct(result, <BackendInterface> cache = null, boolean stream = false)
 	{
 		var rowCount, rows;
 
+		/**
+		 * Rows fetched in advance are passed as an array
+		 */
+		if typeof result == "array" {
+			let this->_rows = array_values(result),
+				this->_count = count(result);
+			if cache !== null {
+				let this->_cache = cache;
+			}
+			return;
+		}
+
 		/**
 		 * 'false' is given as result for empty result-sets
 		 */
@@ -141,6 +171,15 @@ abstract class Resultset
 		 */
 		result->setFetchMode(Db::FETCH_ASSOC);
 
+		/**
+		 * Streaming resultsets don't count the rows, that would require a buffered
+		 * cursor or an additional query
+		 */
+		if stream {
+			let this->_stream = true;
+			return;
+		}
+
 		/**
 		 * Update the row-count
 		 */
@@ -185,6 +224,10 @@ abstract class Resultset
 	 */
 	public function valid() -> boolean
 	{
+		if this->_stream {
+			return typeof this->_row == "array";
+		}
+
 		return this->_pointer < this->_count;
 	}
 
@@ -193,6 +236,13 @@ abstract class Resultset
 	 */
 	public function key() -> int | null
 	{
+		if this->_stream {
+			if typeof this->_row != "array" {
+				return null;
+			}
+			return this->_pointer;
+		}
+
 		if this->_pointer >= this->_count {
 			return null;
 		}
@@ -234,6 +284,29 @@ abstract class Resultset
 			* Fetch from PDO one-by-one.
 			*/
 			let result = this->_result;
+
+			if this->_stream {
+
+				/**
+				 * Unbuffered cursors can't be executed again
+				 */
+				if this->_pointer > position {
+					throw new Exception("Streaming resultsets can only be traversed forward");
+				}
+
+				if this->_row === null {
+					let this->_row = result->$fetch();
+				}
+
+				while this->_pointer < position && this->_row !== false {
+					let this->_row = result->$fetch();
+					let this->_pointer++;
+				}
+
+				let this->_activeRow = null;
+				return;
+			}
+
 			if this->_row === null && this->_pointer === 0 {
 				/**
 				 * Fresh result-set: Query was already executed in model\query::_executeSelect()
@@ -272,6 +345,10 @@ abstract class Resultset
 	 */
 	public final function count() -> int
 	{
+		if this->_stream {
+			throw new Exception("Streaming resultsets can't be counted");
+		}
+
 		return this->_count;
 	}
 
@@ -280,6 +357,10 @@ abstract class Resultset
 	 */
 	public function offsetExists(int index) -> boolean
 	{
+		if this->_stream {
+			throw new Exception("Streaming resultsets can only be traversed forward");
+		}
+
 		return index < this->_count;
 	}
 
@@ -288,7 +369,12 @@ abstract class Resultset
 	 */
 	public function offsetGet(int! index) -> <ModelInterface> | boolean
 	{
-		if index < this->_count {
+		if this->_stream {
+			this->seek(index);
+			if typeof this->_row == "array" {
+				return this->{"current"}();
+			}
+		} elseif index < this->_count {
 	   		/**
 	   		 * Move the cursor to the specific position
 	   		 */
@@ -332,6 +418,11 @@ abstract class Resultset
 	 */
 	public function getFirst() -> <ModelInterface> | boolean
 	{
+		if this->_stream {
+			this->seek(0);
+			return this->{"current"}();
+		}
+
 		if this->_count == 0 {
 			return false;
 		}
@@ -346,6 +437,11 @@ abstract class Resultset
 	public function getLast() -> <ModelInterface> | boolean
 	{
 		var count;
+
+		if this->_stream {
+			throw new Exception("Streaming resultsets can only be traversed forward");
+		}
+
 		let count = this->_count;
 		if count == 0 {
 			return false;
@@ -355,6 +451,14 @@ abstract class Resultset
 		return this->{"current"}();
 	}
 
+	/**
+	 * Check whether the resultset fetches its rows one at a time from an unbuffered cursor
+	 */
+	public function isStream() -> boolean
+	{
+		return this->_stream;
+	}
+
 	/**
 	 * Set if the resultset is fresh or an old one cached
 	 */
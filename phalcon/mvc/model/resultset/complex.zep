@@ -48,15 +48,16 @@ class Complex extends Resultset implements ResultsetInterface
 	 * @param array columnTypes
 	 * @param \Phalcon\Db\ResultInterface result
 	 * @param \Phalcon\Cache\BackendInterface cache
+	 * @param boolean stream
 	 */
-	public function __construct(var columnTypes, <ResultInterface> result = null, <BackendInterface> cache = null)
+	public function __construct(var columnTypes, <ResultInterface> result = null, <BackendInterface> cache = null, boolean stream = false)
 	{
 		/**
 		 * Column types, tell the resultset how to build the result
 		 */
 		let this->_columnTypes = columnTypes;
 
-		parent::__construct(result, cache);
+		parent::__construct(result, cache, stream);
 	}
 
 	/**
@@ -254,6 +255,11 @@ class Complex extends Resultset implements ResultsetInterface
 	public function toArray() -> array
 	{
 		var records, current;
+
+		if this->_stream {
+			throw new Exception("Streaming resultsets can't be exported to an array");
+		}
+
 		let records = [];
 
 		this->rewind();
@@ -0,0 +1,290 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Mvc\Model\Resultset;
+
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\ResultsetInterface;
+
+/**
+ * Phalcon\Mvc\Model\Resultset\Lazy
+ *
+ * Iterates the records of a model in chunks using keyset pagination on its primary key.
+ * Every chunk is a resultset obtained with find() whose rows are greater than the last primary
+ * key of the previous chunk, so the cost of fetching a chunk doesn't grow with the position in
+ * the table and only one chunk is kept in memory
+ *
+ *<code>
+ * $robots = Robots::lazy(
+ *     [
+ *         "type = :type:",
+ *         "bind" => [
+ *             "type" => "mechanical",
+ *         ],
+ *     ],
+ *     500
+ * );
+ *
+ * foreach ($robots as $robot) {
+ *     echo $robot->name, "\n";
+ * }
+ *</code>
+ */
+class Lazy implements \Iterator
+{
+
+	protected _modelName;
+
+	protected _parameters;
+
+	protected _size;
+
+	/**
+	 * Primary key as it is used in PHQL and as it is returned by the database
+	 */
+	protected _primaryKey;
+
+	protected _primaryKeyColumn;
+
+	protected _lastId = null;
+
+	protected _finished = false;
+
+	/**
+	 * Resultset of the current chunk
+	 */
+	protected _chunk = null;
+
+	protected _pointer = 0;
+
+	/**
+	 * Phalcon\Mvc\Model\Resultset\Lazy constructor
+	 *
+	 * @param string modelName
+	 * @param string|array parameters
+	 * @param int size
+	 */
+	public function __construct(string! modelName, var parameters = null, int size = 1000)
+	{
+		var params, model, metaData, primaryKeys, primaryKey, columnMap, attribute;
+
+		if size < 1 {
+			throw new Exception("The size of the chunks must be greater than zero");
+		}
+
+		if typeof parameters != "array" {
+			let params = [];
+			if parameters !== null {
+				let params[] = parameters;
+			}
+		} else {
+			let params = parameters;
+		}
+
+		/**
+		 * The order and the limits of the chunks are defined by the primary key,
+		 * a cache key would return the first chunk for every chunk
+		 */
+		unset params["order"];
+		unset params["limit"];
+		unset params["offset"];
+		unset params["cache"];
+
+		let model = new {modelName}(),
+			metaData = model->getModelsMetaData(),
+			primaryKeys = metaData->getPrimaryKeyAttributes(model);
+
+		if count(primaryKeys) != 1 {
+			throw new Exception("Model '" . modelName . "' must have a single column primary key to be iterated in chunks");
+		}
+
+		let primaryKey = primaryKeys[0];
+
+		/**
+		 * Conditions use the renamed attribute
+		 */
+		let attribute = primaryKey;
+		if globals_get("orm.column_renaming") {
+			let columnMap = metaData->getColumnMap(model);
+			if typeof columnMap == "array" {
+				if !fetch attribute, columnMap[primaryKey] {
+					throw new Exception("Column '" . primaryKey . "' isn't part of the column map");
+				}
+			}
+		}
+
+		let this->_modelName = modelName,
+			this->_parameters = params,
+			this->_size = size,
+			this->_primaryKey = attribute,
+			this->_primaryKeyColumn = primaryKey;
+	}
+
+	/**
+	 * Returns the resultset of the next chunk or false if there are no more records
+	 */
+	public function nextChunk() -> <ResultsetInterface> | boolean
+	{
+		var params, conditions, modelName, resultset, rows, lastRow;
+		int count;
+
+		if this->_finished {
+			return false;
+		}
+
+		let params = this->_parameters;
+
+		if this->_lastId !== null {
+
+			if !fetch conditions, params[0] {
+				if !fetch conditions, params["conditions"] {
+					let conditions = null;
+				}
+			}
+
+			if empty conditions {
+				let conditions = "[" . this->_primaryKey . "] > :chunkLastId:";
+			} else {
+				let conditions = "(" . conditions . ") AND [" . this->_primaryKey . "] > :chunkLastId:";
+			}
+
+			unset params[0];
+			let params["conditions"] = conditions,
+				params["bind"]["chunkLastId"] = this->_lastId;
+		}
+
+		let params["order"] = "[" . this->_primaryKey . "]",
+			params["limit"] = this->_size;
+
+		let modelName = this->_modelName,
+			resultset = {modelName}::find(params);
+
+		/**
+		 * Fetch the rows of the chunk at once, the last one gives the start of the next chunk
+		 */
+		let rows = resultset->toArray(false),
+			count = count(rows);
+
+		if count < this->_size {
+			let this->_finished = true;
+		}
+
+		if !count {
+			return false;
+		}
+
+		let lastRow = rows[count - 1],
+			this->_lastId = lastRow[this->_primaryKeyColumn];
+
+		return resultset;
+	}
+
+	/**
+	 * Starts again from the first chunk
+	 */
+	public function rewind() -> void
+	{
+		var chunk;
+
+		let this->_chunk = null,
+			this->_lastId = null,
+			this->_finished = false,
+			this->_pointer = 0;
+
+		let chunk = this->nextChunk();
+		if typeof chunk == "object" {
+			chunk->rewind();
+			let this->_chunk = chunk;
+		}
+	}
+
+	/**
+	 * Check whether there is a record in the current position
+	 */
+	public function valid() -> boolean
+	{
+		var chunk;
+
+		let chunk = this->_chunk;
+		if typeof chunk != "object" {
+			return false;
+		}
+
+		return chunk->valid();
+	}
+
+	/**
+	 * Returns the current record
+	 */
+	public function current()
+	{
+		var chunk;
+
+		let chunk = this->_chunk;
+		if typeof chunk != "object" {
+			return false;
+		}
+
+		return chunk->current();
+	}
+
+	/**
+	 * Returns the position of the current record among all the chunks
+	 */
+	public function key() -> int | null
+	{
+		if typeof this->_chunk != "object" {
+			return null;
+		}
+
+		return this->_pointer;
+	}
+
+	/**
+	 * Moves to the next record fetching the next chunk when the current one is exhausted
+	 */
+	public function next() -> void
+	{
+		var chunk;
+
+		let chunk = this->_chunk;
+		if typeof chunk != "object" {
+			return;
+		}
+
+		chunk->next();
+		let this->_pointer++;
+
+		if chunk->valid() {
+			return;
+		}
+
+		/**
+		 * Release the current chunk before fetching the next one
+		 */
+		let chunk = null,
+			this->_chunk = null;
+
+		let chunk = this->nextChunk();
+		if typeof chunk == "object" {
+			chunk->rewind();
+			let this->_chunk = chunk;
+		}
+	}
+}
@@ -39,6 +39,11 @@ class Simple extends Resultset
 
 	protected _keepSnapshots = false;
 
+	/**
+	 * Records hydrated in advance, e.g. by eager loading, indexed by position
+	 */
+	protected _records = null;
+
 	/**
 	 * Phalcon\Mvc\Model\Resultset\Simple constructor
 	 *
@@ -47,8 +52,9 @@ class Simple extends Resultset
 	 * @param \Phalcon\Db\Result\Pdo|null result
 	 * @param \Phalcon\Cache\BackendInterface cache
 	 * @param boolean keepSnapshots
+	 * @param boolean stream
 	 */
-	public function __construct(var columnMap, var model, result, <BackendInterface> cache = null, keepSnapshots = null)
+	public function __construct(var columnMap, var model, result, <BackendInterface> cache = null, keepSnapshots = null, boolean stream = false)
 	{
 		let this->_model = model,
 			this->_columnMap = columnMap;
@@ -58,7 +64,7 @@ class Simple extends Resultset
 		 */
 		let this->_keepSnapshots = keepSnapshots;
 
-		parent::__construct(result, cache);
+		parent::__construct(result, cache, stream);
 	}
 
 	/**
@@ -66,13 +72,24 @@ class Simple extends Resultset
 	 */
 	public final function current() -> <ModelInterface> | boolean
 	{
-		var row, hydrateMode, columnMap, activeRow, modelName;
+		var row, hydrateMode, columnMap, activeRow, modelName, records;
 
 		let activeRow = this->_activeRow;
 		if activeRow !== null {
 			return activeRow;
 		}
 
+		/**
+		 * Records hydrated in advance are returned instead of hydrating the row again
+		 */
+		let records = this->_records;
+		if typeof records == "array" {
+			if fetch activeRow, records[this->_pointer] {
+				let this->_activeRow = activeRow;
+				return activeRow;
+			}
+		}
+
 		/**
 		 * Current row is set by seek() operations
 		 */
@@ -155,6 +172,10 @@ class Simple extends Resultset
 		var result, records, record, renamed, renamedKey,
 			key, value, renamedRecords, columnMap;
 
+		if this->_stream {
+			throw new Exception("Streaming resultsets can't be exported to an array");
+		}
+
 		/**
 		 * If _rows is not present, fetchAll from database
 		 * and keep them in memory for further operations
@@ -222,6 +243,120 @@ class Simple extends Resultset
 		return records;
 	}
 
+	/**
+	 * Hydrates every record of the resultset at once and keeps them in memory,
+	 * iterating the resultset again returns the same instances while the raw
+	 * rows are still used by toArray() and serialize()
+	 *
+	 * @return \Phalcon\Mvc\ModelInterface[]
+	 */
+	public function hydrate() -> array
+	{
+		var rows, records;
+
+		if this->_stream {
+			throw new Exception("Streaming resultsets can't be hydrated at once");
+		}
+
+		let rows = [],
+			records = [];
+
+		this->rewind();
+
+		while this->valid() {
+			let records[] = this->current(),
+				rows[] = this->_row;
+			this->next();
+		}
+
+		let this->_rows = rows,
+			this->_records = records,
+			this->_count = count(records),
+			this->_row = null,
+			this->_activeRow = null,
+			this->_pointer = 0;
+
+		return records;
+	}
+
+	/**
+	 * Hydrates every record of the resultset and splits them in resultsets by groups of values
+	 * of an attribute. Every group is identified by a key and it contains the records whose
+	 * attribute is in its list of values, the same record can be part of several groups
+	 *
+	 *<code>
+	 * $parts = RobotsParts::find("robots_id IN (1, 2)");
+	 *
+	 * // Returns [1 => Simple, 2 => Simple] with the parts of every robot
+	 * $partsByRobot = $parts->partition(
+	 *     "robots_id",
+	 *     [
+	 *         1 => [1],
+	 *         2 => [2],
+	 *     ]
+	 * );
+	 *</code>
+	 *
+	 * @param string attribute
+	 * @param array groups
+	 * @return \Phalcon\Mvc\Model\Resultset\Simple[]
+	 */
+	public function partition(string! attribute, array! groups) -> array
+	{
+		var records, rows, record, value, partitions, groupKey, values,
+			groupRecords, groupRows, className, resultset;
+
+		let records = [],
+			rows = [];
+
+		this->rewind();
+
+		while this->valid() {
+
+			let record = this->current();
+
+			if typeof record == "object" {
+				let value = record->readAttribute(attribute);
+				if value !== null {
+					let records[value][] = record,
+						rows[value][] = this->_row;
+				}
+			}
+
+			this->next();
+		}
+
+		let partitions = [],
+			className = get_class(this);
+
+		for groupKey, values in groups {
+
+			let groupRecords = [],
+				groupRows = [];
+
+			if typeof values == "array" {
+				for value in values {
+					if fetch record, records[value] {
+						let groupRecords = array_merge(groupRecords, record),
+							groupRows = array_merge(groupRows, rows[value]);
+					}
+				}
+			}
+
+			/**
+			 * Every partition keeps the raw rows and the records already hydrated
+			 */
+			let resultset = new {className}(this->_columnMap, this->_model, groupRows, null, this->_keepSnapshots);
+			resultset->setHydrateMode(this->_hydrateMode);
+
+			let resultset->_records = groupRecords;
+
+			let partitions[groupKey] = resultset;
+		}
+
+		return partitions;
+	}
+
 	/**
 	 * Serializing a resultset will dump all related rows into a big array
 	 */
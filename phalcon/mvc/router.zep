@@ -21,6 +21,7 @@ namespace Phalcon\Mvc;
 
 use Phalcon\DiInterface;
 use Phalcon\Mvc\Router\Route;
+use Phalcon\Mvc\Router\Tree;
 use Phalcon\Mvc\Router\Exception;
 use Phalcon\Http\RequestInterface;
 use Phalcon\Mvc\Router\GroupInterface;
@@ -95,6 +96,10 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 
 	protected _notFoundPaths;
 
+	protected _useTree = false;
+
+	protected _tree;
+
 	const URI_SOURCE_GET_URL = 0;
 
 	const URI_SOURCE_SERVER_REQUEST_URI = 1;
@@ -216,6 +221,114 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 		return this;
 	}
 
+	/**
+	 * Enables/Disables the static prefix tree used to select the routes
+	 * that are evaluated for an URI. Routes keep their priority order and
+	 * their HTTP method, hostname and beforeMatch constraints, but the
+	 * per-route events are only fired for the routes selected by the tree
+	 *
+	 *<code>
+	 * $router->useTree(true);
+	 *</code>
+	 */
+	public function useTree(boolean! useTree) -> <Router>
+	{
+		let this->_useTree = useTree,
+			this->_tree = null;
+		return this;
+	}
+
+	/**
+	 * Exports the compiled routes, their groups and the prefix tree to a
+	 * string that can be stored in a file or a shared memory cache.
+	 * Converters and beforeMatch callbacks must be callable names,
+	 * closures can't be exported
+	 *
+	 *<code>
+	 * $routes = apcu_fetch("routes");
+	 *
+	 * if ($routes !== false) {
+	 *     $router->import($routes);
+	 * } else {
+	 *     $router->add("/robots/{id:[0-9]+}", "Robots::show");
+	 *
+	 *     apcu_store("routes", $router->export());
+	 * }
+	 *</code>
+	 */
+	public function export() -> string
+	{
+		var tree, e;
+
+		let tree = null;
+		if this->_useTree {
+			let tree = this->_tree;
+			if typeof tree != "object" {
+				let tree = new Tree(this->_routes),
+					this->_tree = tree;
+			}
+		}
+
+		try {
+			return serialize([
+				"routes": this->_routes,
+				"tree":   tree
+			]);
+		} catch \Exception, e {
+			throw new Exception("The routes can't be exported: " . e->getMessage());
+		}
+	}
+
+	/**
+	 * Replaces the routes with the ones exported by Phalcon\Mvc\Router::export()
+	 */
+	public function import(string! data) -> <Router>
+	{
+		var exported, routes, tree;
+
+		let exported = unserialize(data);
+		if typeof exported != "array" || !fetch routes, exported["routes"] {
+			throw new Exception("The exported routes are not valid");
+		}
+
+		if typeof routes != "array" {
+			throw new Exception("The exported routes are not valid");
+		}
+
+		let this->_routes = routes,
+			this->_tree = null;
+
+		if fetch tree, exported["tree"] {
+			if typeof tree == "object" {
+				let this->_tree = tree,
+					this->_useTree = true;
+			}
+		}
+
+		return this;
+	}
+
+	/**
+	 * Returns the routes that can match an URI in priority order
+	 */
+	protected function _getCandidateRoutes(string! uri) -> array
+	{
+		var tree, routes, position;
+
+		let tree = this->_tree;
+		if typeof tree != "object" {
+			let tree = new Tree(this->_routes),
+				this->_tree = tree;
+		}
+
+		let routes = [];
+		for position in tree->getCandidates(uri) {
+			let routes[] = this->_routes[position];
+		}
+
+		return routes;
+	}
+
 	/**
 	 * Sets the name of the default namespace
 	 */
@@ -327,7 +440,7 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 		var realUri, request, currentHostName, routeFound, parts,
 			params, matches, notFoundPaths,
 			vnamespace, module,  controller, action, paramsStr, strParams,
-			route, methods, dependencyInjector,
+			route, routes, methods, dependencyInjector,
 			hostname, regexHostName, matched, pattern, handledUri, beforeMatch,
 			paths, converters, part, position, matchPosition, converter, eventsManager;
 
@@ -364,10 +477,19 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 			eventsManager->fire("router:beforeCheckRoutes", this);
 		}
 
+		/**
+		 * The prefix tree discards the routes that can't match the URI
+		 */
+		if this->_useTree {
+			let routes = this->_getCandidateRoutes(handledUri);
+		} else {
+			let routes = this->_routes;
+		}
+
 		/**
 		 * Routes are traversed in reversed order
 		 */
-		for route in reverse this->_routes {
+		for route in reverse routes {
 			let params = [],
 				matches = null;
 
@@ -707,6 +829,8 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 				throw new Exception("Invalid route position");
 		}
 
+		let this->_tree = null;
+
 		return route;
 	}
 
@@ -830,6 +954,8 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 			let this->_routes = groupRoutes;
 		}
 
+		let this->_tree = null;
+
 		return this;
 	}
 
@@ -850,7 +976,8 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 	 */
 	public function clear() -> void
 	{
-		let this->_routes = [];
+		let this->_routes = [],
+			this->_tree = null;
 	}
 
 	/**
@@ -56,6 +56,8 @@ class Annotations extends Router
 
 	protected _routePrefix;
 
+	protected _processed = false;
+
 	/**
 	 * Adds a resource to the annotations handler
 	 * A resource is a class that contains routing annotations
@@ -84,11 +86,7 @@ class Annotations extends Router
 	 */
 	public function handle(string! uri = null)
 	{
-		var realUri, annotationsService, handlers, controllerSuffix,
-			scope, prefix, dependencyInjector, handler, controllerName,
-			lowerControllerName, namespaceName, moduleName, sufixed, handlerAnnotations,
-			classAnnotations, annotations, annotation, methodAnnotations, method,
-			collection;
+		var realUri;
 
 		if !uri {
 			/**
@@ -99,6 +97,58 @@ class Annotations extends Router
 			let realUri = uri;
 		}
 
+		/**
+		 * Exported or imported routers already contain the routes of every resource
+		 */
+		if !this->_processed {
+			this->_processResources(realUri);
+		}
+
+		/**
+		 * Call the parent handle method()
+		 */
+		parent::handle(realUri);
+	}
+
+	/**
+	 * Exports the routes of every registered resource
+	 *
+	 * @see Phalcon\Mvc\Router::export()
+	 */
+	public function export() -> string
+	{
+		if !this->_processed {
+			this->_processResources(null);
+			let this->_processed = true;
+		}
+
+		return parent::export();
+	}
+
+	/**
+	 * Replaces the routes with the ones exported by Phalcon\Mvc\Router\Annotations::export(),
+	 * the annotations of the resources are not read again
+	 */
+	public function import(string! data) -> <Router>
+	{
+		parent::import(data);
+		let this->_processed = true;
+
+		return this;
+	}
+
+	/**
+	 * Adds the routes of the resources whose prefix matches the URI,
+	 * every resource is processed if the URI is null
+	 */
+	protected function _processResources(var uri) -> void
+	{
+		var annotationsService, handlers, controllerSuffix,
+			scope, prefix, dependencyInjector, handler, controllerName,
+			lowerControllerName, namespaceName, moduleName, sufixed, handlerAnnotations,
+			classAnnotations, annotations, annotation, methodAnnotations, method,
+			collection;
+
 		let dependencyInjector = <DiInterface> this->_dependencyInjector;
 		if typeof dependencyInjector != "object" {
 			throw new Exception("A dependency injection container is required to access the 'annotations' service");
@@ -121,7 +171,7 @@ class Annotations extends Router
 			 */
 			let prefix = scope[0];
 
-			if !empty prefix && !starts_with(realUri, prefix) {
+			if uri !== null && !empty prefix && !starts_with(uri, prefix) {
 				continue;
 			}
 
@@ -198,11 +248,6 @@ class Annotations extends Router
 				}
 			}
 		}
-
-		/**
-		 * Call the parent handle method()
-		 */
-		parent::handle(realUri);
 	}
 
 	/**
@@ -643,6 +643,19 @@ class Route implements RouteInterface
 		return this->_converters;
 	}
 
+	/**
+	 * Keeps the route id generator ahead of the ids of the imported routes
+	 */
+	public function __wakeup()
+	{
+		var uniqueId;
+
+		let uniqueId = self::_uniqueId;
+		if uniqueId === null || uniqueId <= this->_id {
+			let self::_uniqueId = this->_id + 1;
+		}
+	}
+
 	/**
 	 * Resets the internal route id generator
 	 */
@@ -0,0 +1,255 @@
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2017 Phalcon Team (https://phalconphp.com)          |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Mvc\Router;
+
+/**
+ * Phalcon\Mvc\Router\Tree
+ *
+ * Indexes the routes of a router by the static prefix of their compiled
+ * patterns. Routes without regular expressions are stored in a hash table,
+ * the rest are stored in the node of the tree of path segments where
+ * their static prefix ends. Looking up an URI only visits the nodes
+ * of its own segments, so the router evaluates the regular expressions
+ * of the routes that can match it instead of every registered route.
+ *
+ *<code>
+ * $tree = new \Phalcon\Mvc\Router\Tree($router->getRoutes());
+ *
+ * // Positions of the routes that can match the URI
+ * $positions = $tree->getCandidates("/admin/users/edit/10");
+ *</code>
+ */
+class Tree
+{
+
+	/**
+	 * Positions of the routes compared literally, indexed by pattern
+	 */
+	protected _static = [];
+
+	/**
+	 * Static prefixes of the regular expression routes, indexed by node
+	 */
+	protected _nodes = [];
+
+	/**
+	 * Phalcon\Mvc\Router\Tree constructor
+	 *
+	 * @param \Phalcon\Mvc\Router\RouteInterface[] routes
+	 */
+	public function __construct(array routes = [])
+	{
+		var position, route;
+
+		for position, route in routes {
+			this->add(route, position);
+		}
+	}
+
+	/**
+	 * Adds a route to the tree at the given position of the routes list
+	 */
+	public function add(<RouteInterface> route, int position) -> void
+	{
+		var pattern, prefix, node;
+
+		let pattern = route->getCompiledPattern();
+
+		/**
+		 * Patterns without '^' are compared literally by the router
+		 */
+		if !memstr(pattern, "^") {
+			let this->_static[pattern][position] = true;
+			return;
+		}
+
+		let prefix = self::getStaticPrefix(pattern),
+			node = self::getNode(prefix);
+
+		let this->_nodes[node][position] = prefix;
+	}
+
+	/**
+	 * Returns the positions of the routes that can match an URI in ascending order
+	 */
+	public function getCandidates(string! uri) -> array
+	{
+		var candidates, routes, position, prefix, node;
+		int cursor;
+		char ch;
+
+		let candidates = [];
+
+		if fetch routes, this->_static[uri] {
+			let candidates = routes;
+		}
+
+		/**
+		 * The root node stores routes without a static prefix
+		 */
+		if fetch routes, this->_nodes[""] {
+			for position, prefix in routes {
+				if prefix === "" || starts_with(uri, prefix) {
+					let candidates[position] = true;
+				}
+			}
+		}
+
+		/**
+		 * Visit the node of every segment of the URI
+		 */
+		for cursor, ch in uri {
+			if ch == '/' && cursor > 0 {
+				let node = substr(uri, 0, cursor);
+				if fetch routes, this->_nodes[node] {
+					for position, prefix in routes {
+						if starts_with(uri, prefix) {
+							let candidates[position] = true;
+						}
+					}
+				}
+			}
+		}
+
+		ksort(candidates);
+
+		return array_keys(candidates);
+	}
+
+	/**
+	 * Returns the literal text every URI matched by a compiled pattern starts with
+	 *
+	 *<code>
+	 * // Returns "/admin/users/"
+	 * echo \Phalcon\Mvc\Router\Tree::getStaticPrefix("#^/admin/users/([0-9]+)$#u");
+	 *</code>
+	 */
+	public static function getStaticPrefix(string! pattern) -> string
+	{
+		var flags, position, body;
+		int depth = 0;
+		char ch;
+		boolean escaped = false, inClass = false, finished = false;
+		string prefix = "";
+
+		if !starts_with(pattern, "#^") {
+			return "";
+		}
+
+		let position = strrpos(pattern, "#");
+		if position < 2 {
+			return "";
+		}
+
+		/**
+		 * Case insensitive or extended patterns can't be compared literally
+		 */
+		let flags = substr(pattern, position + 1);
+		if flags !== "" && flags !== "u" {
+			return "";
+		}
+
+		let body = substr(pattern, 2, position - 2);
+
+		for ch in body {
+
+			if escaped {
+				let escaped = false;
+				continue;
+			}
+
+			if ch == '\\' {
+				let escaped = true,
+					finished = true;
+				continue;
+			}
+
+			if inClass {
+				if ch == ']' {
+					let inClass = false;
+				}
+				continue;
+			}
+
+			if ch == '[' {
+				let inClass = true,
+					finished = true;
+				continue;
+			}
+
+			if ch == '(' {
+				let depth++,
+					finished = true;
+				continue;
+			}
+
+			if ch == ')' {
+				let depth--;
+				continue;
+			}
+
+			/**
+			 * An alternation outside groups invalidates the prefix
+			 */
+			if ch == '|' {
+				if depth == 0 {
+					return "";
+				}
+				continue;
+			}
+
+			/**
+			 * The previous character is optional
+			 */
+			if ch == '?' || ch == '*' || ch == '{' {
+				if !finished {
+					let prefix = (string) substr(prefix, 0, -1),
+						finished = true;
+				}
+				continue;
+			}
+
+			if ch == '.' || ch == '+' || ch == '$' || ch == '^' || ch == '}' {
+				let finished = true;
+				continue;
+			}
+
+			if !finished {
+				let prefix .= ch;
+			}
+		}
+
+		return prefix;
+	}
+
+	/**
+	 * Returns the node where a prefix is stored: its last complete path segment
+	 */
+	protected static function getNode(string! prefix) -> string
+	{
+		var position;
+
+		let position = strrpos(prefix, "/");
+		if !position {
+			return "";
+		}
+
+		return substr(prefix, 0, position);
+	}
+}
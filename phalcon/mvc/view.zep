@@ -147,6 +147,32 @@ class View extends Injectable implements ViewInterface
 
 	protected _disabled = false;
 
+	/**
+	 * Whether the render levels are written directly to the output
+	 */
+	protected _streaming = false;
+
+	/**
+	 * Levels of the current streaming render: [level, view path, silence]
+	 */
+	protected _streamLevels;
+
+	/**
+	 * Position of the level being streamed, null when not streaming
+	 */
+	protected _streamPosition;
+
+	protected _streamConsumed;
+
+	protected _streamEngines;
+
+	/**
+	 * Output buffering level opened by start()
+	 */
+	protected _bufferLevel = 0;
+
+	protected _bufferClosed = false;
+
 	/**
 	 * Phalcon\Mvc\View constructor
 	 */
@@ -505,7 +531,9 @@ class View extends Injectable implements ViewInterface
 	public function start() -> <View>
 	{
 		ob_start();
-		let this->_content = null;
+		let this->_content = null,
+			this->_bufferLevel = ob_get_level(),
+			this->_bufferClosed = false;
 		return this;
 	}
 
@@ -706,6 +734,8 @@ class View extends Injectable implements ViewInterface
 				throw new Exception("View '" . viewPath . "' was not found in any of the views directory");
 			}
 		}
+
+		return !notExists;
 	}
 
 	/**
@@ -831,6 +861,13 @@ class View extends Injectable implements ViewInterface
 			}
 		}
 
+		/**
+		 * Streamed levels are written to the output, so they can't be cached
+		 */
+		if this->_streaming && this->_cacheLevel {
+			throw new Exception("The view cache can't be used in the streaming render mode");
+		}
+
 		/**
 		 * Start the cache if there is a cache level enabled
 		 */
@@ -864,6 +901,20 @@ class View extends Injectable implements ViewInterface
 		 */
 		let this->_content = ob_get_contents();
 
+		/**
+		 * Streaming renders write the levels directly to the output
+		 */
+		if this->_streaming {
+
+			this->_streamRender(engines, renderView, layoutsDir, layoutName);
+
+			if typeof eventsManager == "object" {
+				eventsManager->fire("view:afterRender", this);
+			}
+
+			return this;
+		}
+
 		let mustClean = true,
 			silence = true;
 
@@ -1164,10 +1215,139 @@ class View extends Injectable implements ViewInterface
 	 */
 	public function finish() -> <View>
 	{
+		/**
+		 * Streaming renders already closed the buffer opened by start()
+		 */
+		if this->_bufferClosed {
+			let this->_bufferClosed = false;
+			return this;
+		}
+
 		ob_end_clean();
 		return this;
 	}
 
+	/**
+	 * Enables or disables the streaming render mode. The levels are rendered
+	 * from the main view inwards and written directly to the output instead
+	 * of being buffered, every call to getContent() renders the previous level
+	 * in place. The buffer opened by start() is closed when the render begins,
+	 * so the HTTP headers must be sent before. Rendering throws an exception if
+	 * the view cache is also enabled
+	 *
+	 *<code>
+	 * $view->stream();
+	 *</code>
+	 */
+	public function stream(boolean streaming = true) -> <View>
+	{
+		let this->_streaming = streaming;
+		return this;
+	}
+
+	/**
+	 * Check whether the render levels are written directly to the output
+	 */
+	public function isStreaming() -> boolean
+	{
+		return this->_streaming;
+	}
+
+	/**
+	 * Renders the levels of a view directly to the output
+	 */
+	protected function _streamRender(engines, string! renderView, string! layoutsDir, string! layoutName) -> void
+	{
+		var disabledLevels, levels, template;
+		int renderLevel;
+
+		let renderLevel = (int) this->_renderLevel,
+			disabledLevels = this->_disabledLevels,
+			levels = [];
+
+		/**
+		 * Levels are listed in the same order they're buffered in the standard render
+		 */
+		if renderLevel >= self::LEVEL_ACTION_VIEW && !isset disabledLevels[self::LEVEL_ACTION_VIEW] {
+			let levels[] = [self::LEVEL_ACTION_VIEW, renderView, true];
+		}
+
+		if renderLevel >= self::LEVEL_BEFORE_TEMPLATE && !isset disabledLevels[self::LEVEL_BEFORE_TEMPLATE] {
+			for template in this->_templatesBefore {
+				let levels[] = [self::LEVEL_BEFORE_TEMPLATE, layoutsDir . template, false];
+			}
+		}
+
+		if renderLevel >= self::LEVEL_LAYOUT && !isset disabledLevels[self::LEVEL_LAYOUT] {
+			let levels[] = [self::LEVEL_LAYOUT, layoutsDir . layoutName, true];
+		}
+
+		if renderLevel >= self::LEVEL_AFTER_TEMPLATE && !isset disabledLevels[self::LEVEL_AFTER_TEMPLATE] {
+			for template in this->_templatesAfter {
+				let levels[] = [self::LEVEL_AFTER_TEMPLATE, layoutsDir . template, false];
+			}
+		}
+
+		if renderLevel >= self::LEVEL_MAIN_LAYOUT && !isset disabledLevels[self::LEVEL_MAIN_LAYOUT] {
+			let levels[] = [self::LEVEL_MAIN_LAYOUT, this->_mainView, true];
+		}
+
+		/**
+		 * The output of the controller is kept as the content of the first level
+		 */
+		if this->_bufferLevel > 0 && ob_get_level() == this->_bufferLevel {
+			ob_end_clean();
+			let this->_bufferLevel = 0,
+				this->_bufferClosed = true;
+		}
+
+		let this->_streamLevels = levels,
+			this->_streamConsumed = [],
+			this->_streamEngines = engines;
+
+		/**
+		 * Without levels the output of the controller is the page
+		 */
+		this->_streamLevel(count(levels) - 1);
+
+		let this->_streamLevels = null,
+			this->_streamPosition = null,
+			this->_streamConsumed = null,
+			this->_streamEngines = null,
+			this->_currentRenderLevel = 0,
+			this->_content = "";
+	}
+
+	/**
+	 * Renders a level of a streaming render, if its view doesn't exist the previous level is rendered instead
+	 */
+	protected function _streamLevel(int position) -> void
+	{
+		var level, previous, rendered;
+
+		if position < 0 {
+			if typeof this->_content == "string" {
+				echo this->_content;
+			}
+			return;
+		}
+
+		let level = this->_streamLevels[position],
+			previous = this->_streamPosition;
+
+		let this->_streamPosition = position,
+			this->_currentRenderLevel = level[0],
+			this->_streamConsumed[position] = false;
+
+		let rendered = this->_engineRender(this->_streamEngines, level[1], level[2], false);
+
+		let this->_streamPosition = previous;
+
+		if !rendered {
+			this->_streamLevel(position - 1);
+		}
+	}
+
 	/**
 	 * Create a Phalcon\Cache based on the internal cache options
 	 */
@@ -1300,6 +1480,23 @@ class View extends Injectable implements ViewInterface
 	 */
 	public function getContent() -> string
 	{
+		var position, currentRenderLevel;
+
+		/**
+		 * While streaming, the previous level is rendered in place
+		 */
+		let position = this->_streamPosition;
+		if position !== null {
+			if !this->_streamConsumed[position] {
+				let this->_streamConsumed[position] = true,
+					currentRenderLevel = this->_currentRenderLevel;
+				this->_streamLevel(position - 1);
+				let this->_streamPosition = position,
+					this->_currentRenderLevel = currentRenderLevel;
+			}
+			return "";
+		}
+
 		return this->_content;
 	}
 
@@ -84,6 +84,22 @@ class Compiler implements InjectionAwareInterface
 
 	protected _compiledTemplatePath;
 
+	/**
+	 * Templates extended or included by the template being compiled
+	 */
+	protected _dependencies;
+
+	/**
+	 * Process-wide compilation counters
+	 */
+	protected static _compiledCount = 0;
+
+	protected static _compileTime = 0.0;
+
+	protected static _waitedCount = 0;
+
+	protected static _staleCount = 0;
+
 	/**
 	 * Phalcon\Mvc\View\Engine\Volt\Compiler
 	 */
@@ -1555,7 +1571,7 @@ class Compiler implements InjectionAwareInterface
 	 */
 	public function compileCache(array! statement, boolean extendsMode = false) -> string
 	{
-		var compilation, expr, exprCode, lifetime;
+		var compilation, expr, exprCode, keyCode, lifetime, tags;
 
 		/**
 		 * A valid expression is required
@@ -1567,17 +1583,30 @@ class Compiler implements InjectionAwareInterface
 		/**
 		 * Cache statement
 		 */
-		let exprCode = this->expression(expr);
+		let exprCode = this->expression(expr),
+			keyCode = exprCode;
 		let compilation = "<?php $_cache[" . this->expression(expr) . "] = $this->di->get('viewCache'); ";
+
+		/**
+		 * Tagged fragments are stored under a key that includes the version of their tags
+		 */
+		if fetch tags, statement["tags"] {
+			if tags["name"] != "tags" {
+				throw new Exception("Unknown cache option '" . tags["name"] . "' in " . statement["file"] . " on line " . statement["line"]);
+			}
+			let keyCode = "$_cacheTaggedKey[" . exprCode . "]";
+			let compilation .= keyCode . " = $_cache[" . exprCode . "]->getTaggedKey(" . exprCode . ", " . this->expression(tags) . "); ";
+		}
+
 		if fetch lifetime, statement["lifetime"] {
 			let compilation .= "$_cacheKey[" . exprCode . "]";
 			if lifetime["type"] == PHVOLT_T_IDENTIFIER {
-				let compilation .= " = $_cache[" . exprCode . "]->start(" . exprCode . ", $" . lifetime["value"] . "); ";
+				let compilation .= " = $_cache[" . exprCode . "]->start(" . keyCode . ", $" . lifetime["value"] . "); ";
 			} else {
-				let compilation .= " = $_cache[" . exprCode . "]->start(" . exprCode . ", " . lifetime["value"] . "); ";
+				let compilation .= " = $_cache[" . exprCode . "]->start(" . keyCode . ", " . lifetime["value"] . "); ";
 			}
 		} else {
-			let compilation .= "$_cacheKey[" . exprCode . "] = $_cache[" . exprCode."]->start(" . exprCode . "); ";
+			let compilation .= "$_cacheKey[" . exprCode . "] = $_cache[" . exprCode."]->start(" . keyCode . "); ";
 		}
 		let compilation .= "if ($_cacheKey[" . exprCode . "] === null) { ?>";
 
@@ -1591,13 +1620,13 @@ class Compiler implements InjectionAwareInterface
 		 */
 		if fetch lifetime, statement["lifetime"] {
 			if lifetime["type"] == PHVOLT_T_IDENTIFIER {
-				let compilation .= "<?php $_cache[" . exprCode . "]->save(" . exprCode . ", null, $" . lifetime["value"] . "); ";
+				let compilation .= "<?php $_cache[" . exprCode . "]->save(" . keyCode . ", null, $" . lifetime["value"] . "); ";
 			} else {
-				let compilation .= "<?php $_cache[" . exprCode . "]->save(" . exprCode . ", null, " . lifetime["value"] . "); ";
+				let compilation .= "<?php $_cache[" . exprCode . "]->save(" . keyCode . ", null, " . lifetime["value"] . "); ";
 			}
 			let compilation .= "} else { echo $_cacheKey[" . exprCode . "]; } ?>";
 		} else {
-			let compilation .= "<?php $_cache[" . exprCode . "]->save(" . exprCode . "); } else { echo $_cacheKey[" . exprCode . "]; } ?>";
+			let compilation .= "<?php $_cache[" . exprCode . "]->save(" . keyCode . "); } else { echo $_cacheKey[" . exprCode . "]; } ?>";
 		}
 
 		return compilation;
@@ -1826,6 +1855,8 @@ class Compiler implements InjectionAwareInterface
 					let compilation = file_get_contents(subCompiler->getCompiledTemplatePath());
 				}
 
+				this->_addDependencies(finalPath, subCompiler->getDependencies());
+
 				return compilation;
 			}
 
@@ -2091,9 +2122,11 @@ class Compiler implements InjectionAwareInterface
 					 * If the compilation doesn't return anything we include the compiled path
 					 */
 					if typeof tempCompilation == "null" {
-						let tempCompilation = file_get_contents(subCompiler->getCompiledTemplatePath());
+						let tempCompilation = subCompiler->_readCompiled(subCompiler->getCompiledTemplatePath(), true);
 					}
 
+					this->_addDependencies(finalPath, subCompiler->getDependencies());
+
 					let this->_extended = true;
 					let this->_extendedBlocks = tempCompilation;
 					let blockMode = extended;
@@ -2323,7 +2356,7 @@ class Compiler implements InjectionAwareInterface
 	 */
 	public function compileFile(string! path, string! compiledPath, boolean extendsMode = false)
 	{
-		var viewCode, compilation, finalCompilation;
+		var viewCode, compilation, finalCompilation, start, temporary;
 
 		if path == compiledPath {
 			throw new Exception("Template path and compilation template path cannot be the same");
@@ -2344,14 +2377,17 @@ class Compiler implements InjectionAwareInterface
 			throw new Exception("Template file " . path . " could not be opened");
 		}
 
-		let this->_currentPath = path;
+		let start = microtime(true);
+
+		let this->_currentPath = path,
+			this->_dependencies = [];
 		let compilation = this->_compileSource(viewCode, extendsMode);
 
 		/**
-		 * We store the file serialized if it's an array of blocks
+		 * An array of blocks is stored as a PHP file returning it, so it's cached by opcache
 		 */
 		if typeof compilation == "array" {
-			let finalCompilation = serialize(compilation);
+			let finalCompilation = "<?php return " . var_export(compilation, true) . "; ";
 		} else {
 			let finalCompilation = compilation;
 		}
@@ -2359,14 +2395,424 @@ class Compiler implements InjectionAwareInterface
 		/**
 		 * Always use file_put_contents to write files instead of write the file
 		 * directly, this respect the open_basedir directive
+		 * The compilation is written to a temporary file and renamed, so other
+		 * processes never include a partially written template
 		 */
-		if file_put_contents(compiledPath, finalCompilation) === false {
+		let temporary = compiledPath . "." . uniqid("", true);
+		if file_put_contents(temporary, finalCompilation) === false {
 			throw new Exception("Volt directory can't be written");
 		}
 
+		if !rename(temporary, compiledPath) {
+			unlink(temporary);
+			throw new Exception("Volt directory can't be written");
+		}
+
+		this->_writeDependencies(compiledPath);
+
+		let self::_compiledCount = self::_compiledCount + 1,
+			self::_compileTime = self::_compileTime + microtime(true) - start;
+
 		return compilation;
 	}
 
+	/**
+	 * Compiles a template holding an advisory lock on the compiled file, so only
+	 * one process compiles it. While another process holds the lock the stale
+	 * compiled file is used if it exists, otherwise it waits for the lock.
+	 * The lock file is removed once the template is compiled
+	 */
+	protected function _compileLocked(string! path, string! compiledPath, boolean extendsMode = false)
+	{
+		var lockPath, handle, stat, compilation, e;
+
+		let lockPath = compiledPath . ".lock";
+
+		loop {
+
+			let handle = fopen(lockPath, "c");
+			if !handle {
+				return this->compileFile(path, compiledPath, extendsMode);
+			}
+
+			if !flock(handle, LOCK_EX | LOCK_NB) {
+
+				if file_exists(compiledPath) {
+					fclose(handle);
+					let self::_staleCount = self::_staleCount + 1;
+					return this->_readCompiled(compiledPath, extendsMode);
+				}
+
+				let self::_waitedCount = self::_waitedCount + 1;
+				flock(handle, LOCK_EX);
+			}
+
+			/**
+			 * A lock obtained on a file removed by the previous holder is obtained again
+			 */
+			clearstatcache(true, lockPath);
+			let stat = fstat(handle);
+			if file_exists(lockPath) && stat["ino"] == fileinode(lockPath) {
+				break;
+			}
+
+			flock(handle, LOCK_UN);
+			fclose(handle);
+		}
+
+		/**
+		 * Another process could have compiled the template while waiting for the lock
+		 */
+		try {
+			if file_exists(compiledPath) && !this->_isStale(path, compiledPath) {
+				let compilation = this->_readCompiled(compiledPath, extendsMode);
+			} else {
+				let compilation = this->compileFile(path, compiledPath, extendsMode);
+			}
+		} catch \Exception, e {
+			this->_releaseLock(handle, lockPath);
+			throw e;
+		}
+
+		this->_releaseLock(handle, lockPath);
+
+		return compilation;
+	}
+
+	/**
+	 * Removes a lock file and releases its lock. The file is removed while it's
+	 * still locked, so processes waiting for it notice it was replaced. Open files
+	 * can't be removed on Windows, where the lock files are kept
+	 */
+	protected function _releaseLock(var handle, string! lockPath) -> void
+	{
+		if PHP_OS != "WINNT" {
+			unlink(lockPath);
+		}
+
+		flock(handle, LOCK_UN);
+		fclose(handle);
+	}
+
+	/**
+	 * Reads an existing compiled template, in extends mode it returns an array of blocks
+	 */
+	protected function _readCompiled(string! compiledPath, boolean extendsMode = false)
+	{
+		var header, blocks, blocksCode;
+
+		if extendsMode !== true {
+			return null;
+		}
+
+		if !file_exists(compiledPath) {
+			throw new Exception("Extends compilation file " . compiledPath . " could not be opened");
+		}
+
+		let header = file_get_contents(compiledPath, false, null, 0, 12);
+
+		if header === "<?php return" {
+			let blocks = require compiledPath;
+			if typeof blocks == "array" {
+				return blocks;
+			}
+			return [];
+		}
+
+		/**
+		 * Files compiled by previous versions contain a serialized array of
+		 * blocks whose code must not be executed
+		 */
+		let blocksCode = file_get_contents(compiledPath);
+		if blocksCode {
+			let blocks = unserialize(blocksCode);
+			if typeof blocks == "array" {
+				return blocks;
+			}
+		}
+
+		return [];
+	}
+
+	/**
+	 * Returns the number of templates compiled by the process, the seconds
+	 * spent compiling them, and how many times a process waited for another
+	 * one compiling a template or used its stale version
+	 *
+	 *<code>
+	 * $stats = \Phalcon\Mvc\View\Engine\Volt\Compiler::getCompileStats();
+	 *
+	 * echo $stats["compiled"], " ", $stats["time"];
+	 *</code>
+	 */
+	public static function getCompileStats() -> array
+	{
+		return [
+			"compiled": self::_compiledCount,
+			"time":     self::_compileTime,
+			"waited":   self::_waitedCount,
+			"stale":    self::_staleCount
+		];
+	}
+
+	/**
+	 * Resets the compilation counters
+	 */
+	public static function resetCompileStats() -> void
+	{
+		let self::_compiledCount = 0,
+			self::_compileTime = 0.0,
+			self::_waitedCount = 0,
+			self::_staleCount = 0;
+	}
+
+	/**
+	 * Returns the templates extended or included, directly or not, by the last compiled template
+	 */
+	public function getDependencies() -> array
+	{
+		var compiledPath;
+
+		if typeof this->_dependencies != "array" {
+			let compiledPath = this->_compiledTemplatePath;
+			if typeof compiledPath == "string" {
+				let this->_dependencies = this->_readDependencies(compiledPath);
+			} else {
+				let this->_dependencies = [];
+			}
+		}
+
+		return array_values(this->_dependencies);
+	}
+
+	/**
+	 * Compiles every template in a directory and its subdirectories applying the
+	 * compiler options, so templates are never compiled while serving requests.
+	 * If the pcntl extension is loaded the templates are split among several processes
+	 *
+	 *<code>
+	 * $compiler->setOptions(
+	 *     [
+	 *         "compiledPath" => "app/cache/volt/",
+	 *         "stat"         => false,
+	 *     ]
+	 * );
+	 *
+	 * $compiler->compileDirectory("app/views/", 4);
+	 *</code>
+	 */
+	public function compileDirectory(string! directory, int processes = 1, string! extension = ".volt") -> array
+	{
+		var iterator, file, templates, chunks, chunk, pids, pid, status,
+			options, failed, resultFile, resultPrefix, e;
+		int position;
+
+		let templates = [];
+
+		let iterator = new \RecursiveIteratorIterator(
+			new \RecursiveDirectoryIterator(directory, \FilesystemIterator::SKIP_DOTS)
+		);
+
+		for file in iterator {
+			if file->isFile() && substr(file->getPathname(), -strlen(extension)) === extension {
+				let templates[] = file->getPathname();
+			}
+		}
+
+		sort(templates);
+
+		if !count(templates) {
+			return templates;
+		}
+
+		/**
+		 * Templates are compiled even if their compiled version is up to date
+		 */
+		let options = this->_options;
+		this->setOption("compileAlways", true);
+
+		if processes < 2 || !function_exists("pcntl_fork") {
+			try {
+				for file in templates {
+					this->compile(file);
+				}
+			} catch \Exception, e {
+				let this->_options = options;
+				throw e;
+			}
+			let this->_options = options;
+			return templates;
+		}
+
+		let chunks = array_chunk(templates, (int) ceil(count(templates) / processes)),
+			pids = [],
+			resultPrefix = sys_get_temp_dir() . DIRECTORY_SEPARATOR . "phvolt-" . getmypid() . "-" . uniqid() . "-";
+
+		/**
+		 * Every child process compiles a chunk, the parent compiles the first one.
+		 * A child reports its success writing a result file, the exit status
+		 * can't be read without passing it by reference to pcntl_waitpid()
+		 */
+		for position, chunk in chunks {
+
+			if position == 0 {
+				continue;
+			}
+
+			let pid = pcntl_fork();
+			if pid == -1 {
+				let this->_options = options;
+				throw new Exception("A process to compile the templates couldn't be created");
+			}
+
+			if pid == 0 {
+				try {
+					for file in chunk {
+						this->compile(file);
+					}
+				} catch \Exception, e {
+					exit(1);
+				}
+				file_put_contents(resultPrefix . position, "1");
+				exit(0);
+			}
+
+			let pids[position] = pid;
+		}
+
+		let failed = false;
+
+		let chunk = chunks[0];
+
+		try {
+			for file in chunk {
+				this->compile(file);
+			}
+		} catch \Exception, e {
+			let failed = e;
+		}
+
+		for position, pid in pids {
+			let status = 0;
+			pcntl_waitpid(pid, status);
+
+			let resultFile = resultPrefix . position;
+			if file_exists(resultFile) {
+				unlink(resultFile);
+			} elseif typeof failed != "object" {
+				let failed = new Exception("Some templates couldn't be compiled");
+			}
+		}
+
+		let this->_options = options;
+
+		if typeof failed == "object" {
+			throw failed;
+		}
+
+		return templates;
+	}
+
+	/**
+	 * Checks whether a compiled template is older than its template or any of the templates it depends on
+	 */
+	protected function _isStale(string! templatePath, string! compiledPath) -> boolean
+	{
+		var dependencies, dependency, compiledTime;
+
+		if compare_mtime(templatePath, compiledPath) {
+			return true;
+		}
+
+		let dependencies = this->_readDependencies(compiledPath),
+			this->_dependencies = dependencies;
+
+		if !count(dependencies) {
+			return false;
+		}
+
+		/**
+		 * The graph is stored flattened, so it's checked in a single pass
+		 */
+		let compiledTime = filemtime(compiledPath);
+		for dependency in dependencies {
+			if !file_exists(dependency) {
+				return true;
+			}
+			if filemtime(dependency) >= compiledTime {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Adds a template and the templates it depends on to the dependencies of the current template
+	 */
+	protected function _addDependencies(string! path, array! dependencies) -> void
+	{
+		var dependency;
+
+		if typeof this->_dependencies != "array" {
+			let this->_dependencies = [];
+		}
+
+		let this->_dependencies[path] = path;
+		for dependency in dependencies {
+			let this->_dependencies[dependency] = dependency;
+		}
+	}
+
+	/**
+	 * Reads the dependencies stored beside a compiled template
+	 */
+	protected function _readDependencies(string! compiledPath) -> array
+	{
+		var path, dependencies;
+
+		let path = compiledPath . ".deps";
+		if !file_exists(path) {
+			return [];
+		}
+
+		let dependencies = require path;
+		if typeof dependencies != "array" {
+			return [];
+		}
+
+		return dependencies;
+	}
+
+	/**
+	 * Stores the dependencies of the compiled template beside it, the compiled
+	 * template itself is left untouched
+	 */
+	protected function _writeDependencies(string! compiledPath) -> void
+	{
+		var path, dependencies, temporary;
+
+		let path = compiledPath . ".deps",
+			dependencies = this->_dependencies;
+
+		if typeof dependencies != "array" || !count(dependencies) {
+			if file_exists(path) {
+				unlink(path);
+			}
+			return;
+		}
+
+		let temporary = path . "." . uniqid("", true);
+		if file_put_contents(temporary, "<?php return " . var_export(array_values(dependencies), true) . "; ") === false {
+			throw new Exception("Volt directory can't be written");
+		}
+
+		if !rename(temporary, path) {
+			unlink(temporary);
+			throw new Exception("Volt directory can't be written");
+		}
+	}
+
 	/**
 	 * Compiles a template into a file applying the compiler options
 	 * This method does not return the compiled path if the template was not compiled
@@ -2379,9 +2825,9 @@ class Compiler implements InjectionAwareInterface
 	 */
 	public function compile(string! templatePath, boolean extendsMode = false)
 	{
-		var stat, compileAlways, prefix, compiledPath, compiledSeparator, blocksCode,
+		var stat, compileAlways, prefix, compiledPath, compiledSeparator,
 			compiledExtension, compilation, options, realCompiledPath,
-			compiledTemplatePath, templateSepPath;
+			compiledTemplatePath, templateSepPath, compileLock;
 
 		/**
 		 * Re-initialize some properties already initialized when the object is cloned
@@ -2393,6 +2839,7 @@ class Compiler implements InjectionAwareInterface
 		let this->_foreachLevel = 0;
 		let this->_blockLevel = 0;
 		let this->_exprLevel = 0;
+		let this->_dependencies = null;
 
 		let stat = true;
 		let compileAlways = false;
@@ -2401,6 +2848,7 @@ class Compiler implements InjectionAwareInterface
 		let compiledSeparator = "%%";
 		let compiledExtension = ".php";
 		let compilation = null;
+		let compileLock = true;
 
 		let options = this->_options;
 		if typeof options == "array" {
@@ -2463,6 +2911,16 @@ class Compiler implements InjectionAwareInterface
 			if isset options["stat"] {
 				let stat = options["stat"];
 			}
+
+			/**
+			 * Only one process compiles a template at the same time
+			 */
+			if isset options["compileLock"] {
+				let compileLock = options["compileLock"];
+				if typeof compileLock != "boolean" {
+					throw new Exception("'compileLock' must be a bool value");
+				}
+			}
 		}
 
 		/**
@@ -2530,38 +2988,32 @@ class Compiler implements InjectionAwareInterface
 				if file_exists(compiledTemplatePath) {
 
 					/**
-					 * Compare modification timestamps to check if the file needs to be recompiled
+					 * Compare modification timestamps of the template and the templates
+					 * it depends on to check if the file needs to be recompiled
 					 */
-					if compare_mtime(templatePath, realCompiledPath) {
-						let compilation = this->compileFile(templatePath, realCompiledPath, extendsMode);
+					if this->_isStale(templatePath, realCompiledPath) {
+						if compileLock {
+							let compilation = this->_compileLocked(templatePath, realCompiledPath, extendsMode);
+						} else {
+							let compilation = this->compileFile(templatePath, realCompiledPath, extendsMode);
+						}
 					} else {
 
-						if extendsMode === true {
-
-							/**
-							 * In extends mode we read the file that must contains a serialized array of blocks
-							 */
-							let blocksCode = file_get_contents(realCompiledPath);
-							if blocksCode === false {
-								throw new Exception("Extends compilation file " . realCompiledPath . " could not be opened");
-							}
-
-							/**
-							 * Unserialize the array blocks code
-							 */
-							if blocksCode {
-								let compilation = unserialize(blocksCode);
-							} else {
-								let compilation = [];
-							}
-						}
+						/**
+						 * In extends mode we read the file that must contains a serialized array of blocks
+						 */
+						let compilation = this->_readCompiled(realCompiledPath, extendsMode);
 					}
 				} else {
 
 					/**
 					 * The file doesn't exist so we compile the php version for the first time
 					 */
-					let compilation = this->compileFile(templatePath, realCompiledPath, extendsMode);
+					if compileLock {
+						let compilation = this->_compileLocked(templatePath, realCompiledPath, extendsMode);
+					} else {
+						let compilation = this->compileFile(templatePath, realCompiledPath, extendsMode);
+					}
 				}
 			} else {
 
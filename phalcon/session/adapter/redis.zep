@@ -76,6 +76,14 @@ class Redis extends Adapter
 			let options["persistent"] = false;
 		}
 
+		/**
+		 * Sessions are never queried by key, writing them doesn't need to track
+		 * the keys unless a "statsKey" is given
+		 */
+		if !isset options["lean"] && !isset options["statsKey"] {
+			let options["lean"] = true;
+		}
+
 		if fetch lifetime, options["lifetime"] {
 			let this->_lifetime = lifetime;
 		}
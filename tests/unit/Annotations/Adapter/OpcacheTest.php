@@ -0,0 +1,76 @@
+<?php
+
+namespace Phalcon\Test\Unit\Annotations\Adapter;
+
+use Phalcon\Test\Module\UnitTest;
+use Phalcon\Annotations\Adapter\Opcache;
+
+/**
+ * \Phalcon\Test\Unit\Annotations\Adapter\OpcacheTest
+ * Tests for \Phalcon\Annotations\Adapter\Opcache component
+ *
+ * @copyright (c) 2011-2017 Phalcon Team
+ * @link      https://phalconphp.com
+ * @author    Andres Gutierrez <andres@phalconphp.com>
+ * @author    Serghei Iakovlev <serghei@phalconphp.com>
+ * @package   Phalcon\Test\Unit\Annotations
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+class OpcacheTest extends UnitTest
+{
+    public function testOpcacheAdapter()
+    {
+        require_once PATH_DATA . 'annotations/TestClass.php';
+        require_once PATH_DATA . 'annotations/TestClassNs.php';
+
+        Opcache::reset();
+
+        $adapter = new Opcache(['annotationsDir' => PATH_OUTPUT . 'tests/annotations/']);
+
+        $classAnnotations = $adapter->get('TestClass');
+        $this->assertTrue(is_object($classAnnotations));
+        $this->assertEquals(get_class($classAnnotations), 'Phalcon\Annotations\Reflection');
+        $this->assertEquals(get_class($classAnnotations->getClassAnnotations()), 'Phalcon\Annotations\Collection');
+
+        $entry = require PATH_OUTPUT . 'tests/annotations/testclass.php';
+        $this->assertTrue(is_array($entry['data']));
+        $this->assertEquals(filemtime(PATH_DATA . 'annotations/TestClass.php'), $entry['mtime']);
+
+        Opcache::reset();
+
+        $adapter = new Opcache(['annotationsDir' => PATH_OUTPUT . 'tests/annotations/']);
+
+        $classAnnotations = $adapter->read('TestClass');
+        $this->assertTrue(is_object($classAnnotations));
+        $this->assertEquals(get_class($classAnnotations->getClassAnnotations()), 'Phalcon\Annotations\Collection');
+
+        // Entries of modified classes are parsed again
+        $entry['mtime']--;
+        file_put_contents(PATH_OUTPUT . 'tests/annotations/testclass.php', '<?php return ' . var_export($entry, true) . ';');
+
+        Opcache::reset();
+
+        $this->assertFalse($adapter->read('TestClass'));
+
+        $adapter = new Opcache(['annotationsDir' => PATH_OUTPUT . 'tests/annotations/', 'stat' => false]);
+        $this->assertTrue(is_object($adapter->read('TestClass')));
+
+        $this->assertEquals(['User\TestClassNs'], $adapter->preload(PATH_DATA . 'annotations/', 'User'));
+        $this->assertTrue(is_object($adapter->read('User\TestClassNs')));
+
+        unset($adapter);
+
+        Opcache::reset();
+
+        $this->tester->amInPath(PATH_OUTPUT . 'tests/annotations/');
+
+        $this->tester->deleteFile('testclass.php');
+        $this->tester->deleteFile('user_testclassns.php');
+    }
+}
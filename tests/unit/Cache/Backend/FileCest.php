@@ -4,6 +4,7 @@ namespace Phalcon\Test\Unit\Cache\Backend;
 
 use UnitTester;
 use Phalcon\Cache\Backend\File;
+use Phalcon\Cache\Frontend\Data;
 use Phalcon\Cache\Frontend\Output;
 use Phalcon\Cache\Frontend\Igbinary;
 
@@ -206,4 +207,91 @@ class FileCest
         // Delete cache
         $I->dontSeeFileFound('igbinary_' . $backend->getKey('test-data'));
     }
+
+    public function sharding(UnitTester $I)
+    {
+        $I->wantTo("Use File cache with sharded directories");
+
+        $cacheDir = PATH_CACHE . 'sharded/';
+        @mkdir($cacheDir);
+
+        $cache = new File(new Data(['lifetime' => 20]), [
+            'cacheDir' => $cacheDir,
+            'sharding' => true,
+        ]);
+
+        $data = [1, 2, 3, 4, 5];
+        $I->assertTrue($cache->save('sharded-key', $data));
+
+        $hash = md5('sharded-key');
+        $file = $cacheDir . substr($hash, 0, 2) . DIRECTORY_SEPARATOR . substr($hash, 2, 2) . DIRECTORY_SEPARATOR . 'sharded-key';
+
+        $I->assertTrue(file_exists($file));
+        $I->assertRegExp('/^[0-9]{20}/', file_get_contents($file));
+        $I->assertEquals($data, $cache->get('sharded-key'));
+        $I->assertTrue($cache->exists('sharded-key'));
+        $I->assertEquals(['sharded-key'], $cache->queryKeys());
+
+        $I->assertTrue($cache->save('sharded-counter', 10));
+        $I->assertEquals(15, $cache->increment('sharded-counter', 5));
+        $I->assertEquals(12, $cache->decrement('sharded-counter', 3));
+
+        $I->assertTrue($cache->save('sharded-expired', 'expired', 1));
+        sleep(2);
+
+        $I->assertNull($cache->get('sharded-expired'));
+        $I->assertFalse($cache->exists('sharded-expired'));
+        $I->assertEquals(1, $cache->gc(65536 * 2));
+        $I->assertEquals(['sharded-counter', 'sharded-key'], $this->sortedKeys($cache));
+
+        $I->assertTrue($cache->flush());
+        $I->assertEquals([], $cache->queryKeys());
+
+        foreach (new \RecursiveIteratorIterator(
+            new \RecursiveDirectoryIterator($cacheDir, \FilesystemIterator::SKIP_DOTS),
+            \RecursiveIteratorIterator::CHILD_FIRST
+        ) as $item) {
+            $item->isDir() ? rmdir($item->getPathname()) : unlink($item->getPathname());
+        }
+
+        rmdir($cacheDir);
+    }
+
+    public function temporaryFiles(UnitTester $I)
+    {
+        $I->wantTo("Remove the temporary files of interrupted writes by using File cache");
+
+        $cacheDir = PATH_CACHE . 'temporary/';
+        @mkdir($cacheDir);
+
+        $cache = new File(new Data(['lifetime' => 20]), ['cacheDir' => $cacheDir]);
+
+        $I->assertTrue($cache->save('temporary-key', 'value'));
+
+        $stale = $cacheDir . '.temporary-key.' . uniqid('', true);
+        $recent = $cacheDir . '.temporary-key.' . uniqid('', true);
+        file_put_contents($stale, 'partial');
+        file_put_contents($recent, 'partial');
+        touch($stale, time() - 7200);
+
+        $I->assertEquals(['temporary-key'], $cache->queryKeys());
+
+        $I->assertEquals(0, $cache->gc());
+        $I->assertFalse(file_exists($stale));
+        $I->assertTrue(file_exists($recent));
+
+        $I->assertTrue($cache->flush());
+        $I->assertEquals([], $cache->queryKeys());
+
+        unlink($recent);
+        rmdir($cacheDir);
+    }
+
+    protected function sortedKeys(File $cache)
+    {
+        $keys = $cache->queryKeys();
+        sort($keys);
+
+        return $keys;
+    }
 }
@@ -0,0 +1,122 @@
+<?php
+
+namespace Phalcon\Test\Unit\Cache\Backend;
+
+use UnitTester;
+use Phalcon\Cache\Multiple;
+use Phalcon\Cache\Frontend\Data;
+use Phalcon\Cache\Frontend\None;
+use Phalcon\Cache\Backend\Lru;
+use Phalcon\Cache\Backend\Memory;
+
+/**
+ * \Phalcon\Test\Unit\Cache\Backend\LruCest
+ * Tests the \Phalcon\Cache\Backend\Lru component
+ *
+ * @copyright (c) 2011-2017 Phalcon Team
+ * @link      https://phalconphp.com
+ * @author    Andres Gutierrez <andres@phalconphp.com>
+ * @author    Serghei Iakovlev <serghei@phalconphp.com>
+ * @package   Phalcon\Test\Unit\Cache\Backend
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+class LruCest
+{
+    public function evict(UnitTester $I)
+    {
+        $I->wantTo('Evict the least recently used entries by using Lru as cache backend');
+
+        $cache = new Lru(new Data(['lifetime' => 20]), ['size' => 2]);
+
+        $I->assertTrue($cache->save('a', [1]));
+        $I->assertTrue($cache->save('b', [2]));
+        $I->assertEquals([1], $cache->get('a'));
+
+        $I->assertTrue($cache->save('c', [3]));
+
+        $I->assertEquals(['a', 'c'], $cache->queryKeys());
+        $I->assertNull($cache->get('b'));
+        $I->assertEquals([3], $cache->get('c'));
+
+        $stats = $cache->getStats();
+        $I->assertEquals(2, $stats['hits']);
+        $I->assertEquals(1, $stats['misses']);
+        $I->assertEquals(1, $stats['evictions']);
+        $I->assertEquals(2, $stats['entries']);
+        $I->assertEquals(2 / 3, $cache->getHitRatio());
+
+        $cache->resetStats();
+        $I->assertEquals(0, $cache->getHitRatio());
+    }
+
+    public function lifetime(UnitTester $I)
+    {
+        $I->wantTo('Expire entries by using Lru as cache backend');
+
+        $cache = new Lru(new None(['lifetime' => 20]));
+
+        $I->assertTrue($cache->save('expiring', 'value', 1));
+        $I->assertTrue($cache->save('counter', 10));
+        $I->assertEquals('value', $cache->get('expiring'));
+        $I->assertEquals(15, $cache->increment('counter', 5));
+        $I->assertEquals(12, $cache->decrement('counter', 3));
+
+        sleep(2);
+
+        $I->assertNull($cache->get('expiring'));
+        $I->assertFalse($cache->exists('expiring'));
+        $I->assertTrue($cache->exists('counter'));
+    }
+
+    public function exclude(UnitTester $I)
+    {
+        $I->wantTo('Exclude keys by using Lru as cache backend');
+
+        $cache = new Lru(new None(['lifetime' => 20]), ['exclude' => ['session-']]);
+
+        $I->assertTrue($cache->save('session-1', 'value'));
+        $I->assertTrue($cache->save('other', 'value'));
+
+        $I->assertNull($cache->get('session-1'));
+        $I->assertEquals('value', $cache->get('other'));
+        $I->assertTrue($cache->isExcluded('session-1'));
+    }
+
+    public function multiple(UnitTester $I)
+    {
+        $I->wantTo('Use Lru as the first tier of Multiple with negative caching');
+
+        $lru = new Lru(new None(['lifetime' => 20]), ['negativeLifetime' => 20]);
+        $remote = new Memory(new Data(['lifetime' => 20]));
+
+        $cache = new Multiple([$lru, $remote]);
+
+        $remote->save('remote-key', [1, 2, 3]);
+
+        $I->assertEquals([1, 2, 3], $cache->get('remote-key'));
+        $I->assertEquals([1, 2, 3], $lru->get('remote-key'));
+
+        $I->assertNull($cache->get('missing-key'));
+        $I->assertTrue($lru->isNegative('missing-key'));
+
+        // The remote backend isn't asked again while the miss is remembered
+        $remote->save('missing-key', 'now-existing');
+        $I->assertNull($cache->get('missing-key'));
+
+        $cache->save('missing-key', 'now-existing');
+        $I->assertFalse($lru->isNegative('missing-key'));
+        $I->assertEquals('now-existing', $cache->get('missing-key'));
+
+        $I->assertEquals(
+            ['remote-key' => [1, 2, 3], 'other-missing' => null],
+            $cache->getMany(['remote-key', 'other-missing'])
+        );
+        $I->assertTrue($lru->isNegative('other-missing'));
+    }
+}
@@ -6,6 +6,8 @@ use UnitTester;
 use Phalcon\Cache\Frontend\Data;
 use Phalcon\Cache\Frontend\None;
 use Phalcon\Cache\Backend\Memory;
+use Phalcon\Cache\Exception;
+use Phalcon\Cache\Multiple;
 
 /**
  * \Phalcon\Test\Unit\Cache\Backend\MemoryCest
@@ -86,6 +88,83 @@ class MemoryCest
         $I->assertFalse($cache->delete($key));
     }
 
+    public function many(UnitTester $I)
+    {
+        $I->wantTo('Get, save and delete several keys by using Memory as cache backend');
+
+        $data = [uniqid(), gethostname(), microtime(), get_include_path(), time()];
+
+        $cache = new Memory(new Data(['lifetime' => 20]));
+
+        $I->assertTrue($cache->saveMany(['many-1' => $data, 'many-2' => 2017]));
+        $I->assertEquals(
+            ['many-1' => $data, 'many-2' => 2017, 'many-3' => null],
+            $cache->getMany(['many-1', 'many-2', 'many-3'])
+        );
+
+        $I->assertTrue($cache->deleteMany(['many-1', 'many-2']));
+        $I->assertEquals(['many-1' => null, 'many-2' => null], $cache->getMany(['many-1', 'many-2']));
+        $I->assertFalse($cache->deleteMany(['many-1']));
+    }
+
+    public function remember(UnitTester $I)
+    {
+        $I->wantTo('Get or compute data by using Memory as cache backend');
+
+        $cache = new Memory(new Data(['lifetime' => 20]));
+        $calls = 0;
+        $computer = function ($value) use (&$calls) {
+            $calls++;
+            return $value;
+        };
+
+        $I->assertEquals('computed', $cache->remember('remember', 20, $computer, ['computed']));
+        $I->assertTrue($cache->isFresh());
+        $I->assertEquals('computed', $cache->get('remember'));
+        $I->assertNull($cache->get('_PHCL' . 'remember'));
+
+        $I->assertEquals('computed', $cache->remember('remember', 20, $computer, ['other']));
+        $I->assertFalse($cache->isFresh());
+        $I->assertEquals(1, $calls);
+
+        // Expired early: the worker holding the lock recomputes, the others serve the current content
+        $cache->save('_PHCM' . 'remember', [1, time() - 1]);
+        $cache->save('_PHCL' . 'remember', 1);
+
+        $I->assertEquals('computed', $cache->remember('remember', 20, $computer, ['other']));
+        $I->assertEquals(1, $calls);
+
+        $cache->delete('_PHCL' . 'remember');
+
+        $I->assertEquals('other', $cache->remember('remember', 20, $computer, ['other']));
+        $I->assertTrue($cache->isFresh());
+        $I->assertEquals(2, $calls);
+    }
+
+    public function rememberWithoutLifetime(UnitTester $I)
+    {
+        $I->wantTo('Get or compute data with the frontend lifetime by using Memory as cache backend');
+
+        $cache = new Memory(new Data(['lifetime' => 20]));
+        $calls = 0;
+        $computer = function ($value) use (&$calls) {
+            $calls++;
+            return $value;
+        };
+
+        $I->assertEquals('computed', $cache->remember('remember', null, $computer, ['computed']));
+
+        // The expiration is taken from the frontend instead of the current time
+        $meta = $cache->get('_PHCM' . 'remember');
+        $I->assertGreaterThanOrEqual(time() + 19, $meta[1]);
+
+        for ($i = 0; $i < 10; $i++) {
+            $I->assertEquals('computed', $cache->remember('remember', null, $computer, ['other']));
+        }
+
+        $I->assertEquals(1, $calls);
+    }
+
     public function increment(UnitTester $I)
     {
         $I->wantTo('Increment counter by using Memory as cache backend');
@@ -163,4 +242,57 @@ class MemoryCest
         $I->assertEquals($s1, $s3);
         $I->assertEquals($s1, $string);
     }
+
+    public function invalidateTag(UnitTester $I)
+    {
+        $I->wantTo('Invalidate tagged data by using Memory as cache backend');
+
+        $cache = new Memory(new Data(['lifetime' => 20]));
+
+        $sidebar = $cache->getTaggedKey('sidebar', ['user:5', 'catalog']);
+        $footer  = $cache->getTaggedKey('footer', ['catalog']);
+
+        $I->assertEquals($sidebar, $cache->getTaggedKey('sidebar', ['user:5', 'catalog']));
+        $I->assertEquals('sidebar', $cache->getTaggedKey('sidebar', []));
+
+        $I->assertTrue($cache->save($sidebar, 'sidebar content'));
+        $I->assertTrue($cache->save($footer, 'footer content'));
+
+        $I->assertTrue($cache->invalidateTag('user:5'));
+
+        $I->assertNotEquals($sidebar, $cache->getTaggedKey('sidebar', ['user:5', 'catalog']));
+        $I->assertEquals($footer, $cache->getTaggedKey('footer', ['catalog']));
+        $I->assertNull($cache->get($cache->getTaggedKey('sidebar', ['user:5', 'catalog'])));
+        $I->assertEquals('footer content', $cache->get($footer));
+    }
+
+    public function multipleTaggedKey(UnitTester $I)
+    {
+        $I->wantTo('Share the tagged keys between the backends of Multiple');
+
+        $first  = new Memory(new Data(['lifetime' => 20]));
+        $second = new Memory(new Data(['lifetime' => 20]));
+
+        $cache = new Multiple([$first, $second]);
+
+        $key = $cache->getTaggedKey('sidebar', ['user:5']);
+
+        $I->assertEquals($first->getTaggedKey('sidebar', ['user:5']), $key);
+        $I->assertFalse($second->exists('_PHCT_user:5'));
+
+        $cache->save($key, 'sidebar content');
+        $first->delete($key);
+
+        $I->assertEquals('sidebar content', $cache->get($cache->getTaggedKey('sidebar', ['user:5'])));
+
+        $I->assertTrue($cache->invalidateTag('user:5'));
+        $I->assertNotEquals($key, $cache->getTaggedKey('sidebar', ['user:5']));
+
+        $I->expectException(
+            new Exception('Tags require a Phalcon\\Cache\\Backend as the first backend'),
+            function () {
+                (new Multiple())->getTaggedKey('sidebar', ['user:5']);
+            }
+        );
+    }
 }
@@ -245,6 +245,32 @@ class RedisCest
         $I->dontSeeInRedis('_PHCR' . 'some-key-to-delete');
     }
 
+    public function many(UnitTester $I)
+    {
+        $I->wantTo('Get, save and delete several keys by using Redis as cache backend');
+
+        $cache = new Redis(new Data(['lifetime' => 20]), [
+            'host' => env('TEST_RS_HOST'),
+            'port' => env('TEST_RS_PORT')
+        ]);
+
+        $data = [1, 2, 3, 4, 5];
+
+        $I->assertTrue($cache->saveMany(['many-1' => $data, 'many-2' => 'string', 'many-3' => 100]));
+        $I->seeInRedis('_PHCR' . 'many-1', serialize($data));
+        $I->seeInRedis('_PHCR' . 'many-3', 100);
+
+        $I->assertEquals(
+            ['many-1' => $data, 'many-2' => 'string', 'many-3' => 100, 'many-4' => null],
+            $cache->getMany(['many-1', 'many-2', 'many-3', 'many-4'])
+        );
+
+        $I->assertTrue($cache->deleteMany(['many-1', 'many-2', 'many-3']));
+        $I->dontSeeInRedis('_PHCR' . 'many-1');
+        $I->dontSeeInRedis('_PHCR' . 'many-2');
+        $I->dontSeeInRedis('_PHCR' . 'many-3');
+    }
+
     public function flush(UnitTester $I)
     {
         $I->wantTo('Flush cache by using Redis as cache backend');
@@ -297,6 +323,54 @@ class RedisCest
         $I->assertEquals(['a', 'b', 'c'], $keys);
     }
 
+    public function leanQueryKeys(UnitTester $I)
+    {
+        $I->wantTo('Get cache keys with SCAN by using Redis as cache backend in lean mode');
+
+        $cache = new Redis(new Data(['lifetime' => 20]), [
+            'host'     => env('TEST_RS_HOST'),
+            'port'     => env('TEST_RS_PORT'),
+            'statsKey' => '_PHCR',
+            'lean'     => true,
+        ]);
+
+        $I->assertTrue($cache->save('lean-a', 1));
+        $I->assertTrue($cache->save('lean-b', 2));
+        $I->assertTrue($cache->save('other-c', 3));
+
+        $I->dontSeeInRedis('_PHCR');
+
+        $keys = $cache->queryKeys('lean-');
+        sort($keys);
+
+        $I->assertEquals(['lean-a', 'lean-b'], $keys);
+
+        $I->assertTrue($cache->flush());
+        $I->dontSeeInRedis('_PHCR' . 'lean-a');
+        $I->dontSeeInRedis('_PHCR' . 'other-c');
+    }
+
+    public function incrementWithLifetime(UnitTester $I)
+    {
+        $I->wantTo('Increment counter with a lifetime by using Redis as cache backend');
+
+        $key = '_PHCR' . 'increment-lifetime';
+        $cache = new Redis(new Data(['lifetime' => 20]), [
+            'host' => env('TEST_RS_HOST'),
+            'port' => env('TEST_RS_PORT')
+        ]);
+
+        $I->dontSeeInRedis($key);
+
+        $I->assertEquals(1, $cache->increment('increment-lifetime', 1, 1));
+        $I->assertEquals(3, $cache->increment('increment-lifetime', 2, 1));
+        $I->assertEquals(2, $cache->decrement('increment-lifetime', 1, 1));
+        $I->seeInRedis($key, 2);
+
+        sleep(2);
+        $I->dontSeeInRedis($key);
+    }
+
     public function queryKeysWithoutStatsKey(UnitTester $I)
     {
         $I->wantTo('Catch exception during the attempt getting cache keys by using Redis as cache backend without statsKey');
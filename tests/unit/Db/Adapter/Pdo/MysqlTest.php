@@ -151,4 +151,116 @@ class MysqlTest extends UnitTest
             ]
         );
     }
+
+    /**
+     * Tests Mysql::insertMany
+     */
+    public function testInsertMany()
+    {
+        $this->specify(
+            'Rows are not inserted by chunks',
+            function ($rows, $fields, $chunkSize) {
+                $this->connection->begin();
+
+                $before = $this->connection->fetchColumn("SELECT COUNT(*) FROM prueba");
+
+                expect($this->connection->insertMany("prueba", $rows, $fields, null, $chunkSize))->true();
+
+                $after = $this->connection->fetchColumn("SELECT COUNT(*) FROM prueba");
+
+                $this->connection->rollback();
+
+                expect($after - $before)->equals(count($rows));
+            },
+            [
+                "examples" => [
+                    [
+                        "rows"      => [["LOL 1", "A"], ["LOL 2", "I"], ["LOL 3", "A"]],
+                        "fields"    => ["nombre", "estado"],
+                        "chunkSize" => 2,
+                    ],
+                    [
+                        "rows"      => [
+                            ["nombre" => "LOL 1", "estado" => "A"],
+                            ["nombre" => "LOL 2", "estado" => "I"],
+                            ["nombre" => "LOL 3", "estado" => "A"],
+                        ],
+                        "fields"    => null,
+                        "chunkSize" => 1000,
+                    ],
+                    [
+                        "rows"      => [
+                            ["nombre" => "LOL 1", "estado" => "A", "other" => 1],
+                            ["nombre" => "LOL 2", "estado" => "I", "other" => 2],
+                        ],
+                        "fields"    => ["nombre", "estado"],
+                        "chunkSize" => 1,
+                    ],
+                ]
+            ]
+        );
+
+        $this->specify(
+            'The chunks of a failed insert are not rolled back',
+            function () {
+                $before = $this->connection->fetchColumn("SELECT COUNT(*) FROM prueba");
+
+                $rows = [["LOL 1", "A"], ["LOL 2", "I"], ["LOL 3"]];
+
+                $failed = false;
+                try {
+                    $this->connection->insertMany("prueba", $rows, ["nombre", "estado"], null, 1);
+                } catch (\Phalcon\Db\Exception $e) {
+                    $failed = true;
+                }
+
+                expect($failed)->true();
+                expect($this->connection->isUnderTransaction())->false();
+                expect($this->connection->fetchColumn("SELECT COUNT(*) FROM prueba"))->equals($before);
+            }
+        );
+    }
+
+    /**
+     * Tests Mysql::setStatementCacheSize
+     */
+    public function testStatementCache()
+    {
+        $this->specify(
+            'Prepared statements are not reused',
+            function () {
+                $this->connection->setStatementCacheSize(2);
+
+                $sql = "SELECT id FROM robots WHERE id = ?";
+
+                $this->connection->execute($sql, [1]);
+                $this->connection->execute($sql, [2]);
+                $this->connection->execute("SELECT id FROM robots WHERE name = ?", ["Robotina"]);
+                $this->connection->execute("SELECT id FROM robots WHERE type = ?", ["mechanical"]);
+
+                expect($this->connection->getStatementCacheStats())->equals([
+                    "size"      => 2,
+                    "hits"      => 1,
+                    "misses"    => 3,
+                    "evictions" => 1,
+                ]);
+
+                $this->connection->execute("SELECT id FROM robots WHERE type = ?", ["cyborg"]);
+                expect($this->connection->affectedRows())->equals(1);
+
+                // Results of query() keep their own statement
+                $first = $this->connection->query($sql, [1]);
+                $second = $this->connection->query($sql, [3]);
+
+                expect($first->fetch()["id"])->equals(1);
+                expect($second->fetch()["id"])->equals(3);
+                expect($this->connection->getStatementCacheStats()["hits"])->equals(2);
+
+                $this->connection->connect();
+
+                $stats = $this->connection->getStatementCacheStats();
+                expect($stats["size"])->equals(0);
+            }
+        );
+    }
 }
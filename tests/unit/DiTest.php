@@ -3,9 +3,11 @@
 namespace Phalcon\Test\Unit;
 
 use Phalcon\Di;
+use Phalcon\Di\Proxy;
 use Phalcon\Di\Service;
 use Phalcon\Http\Request;
 use Phalcon\Http\Response;
+use Phalcon\Http\ResponseInterface;
 use Phalcon\Test\Module\UnitTest;
 
 /**
@@ -503,4 +505,162 @@ class DiTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests compiling the services to a factory class and freezing the container
+     */
+    public function testCompileAndFreeze()
+    {
+        $this->specify(
+            "Compiled services are built by the factory of a frozen container",
+            function () {
+                $this->phDi->setShared('response', Response::class);
+                $this->phDi->set('request', Request::class);
+                $this->phDi->set(
+                    'component',
+                    [
+                        'className' => 'InjectableComponent',
+                        'arguments' => [
+                            ['type' => 'service', 'name' => 'response'],
+                        ],
+                        'properties' => [
+                            [
+                                'name'  => 'other',
+                                'value' => ['type' => 'parameter', 'value' => 'other'],
+                            ],
+                        ],
+                    ]
+                );
+                $this->phDi->set(
+                    'closure',
+                    function () {
+                        return new \SomeComponent('closure');
+                    }
+                );
+
+                $className = 'CompiledDi' . uniqid();
+                $source = $this->phDi->compile($className);
+
+                expect($source)->startsWith('<?php');
+                expect($source)->notContains("'closure'");
+
+                eval(substr($source, 5));
+
+                $factory = new $className();
+                expect($factory->getMethods())->hasKey('component');
+
+                $this->phDi->freeze($factory);
+
+                expect($this->phDi->isFrozen())->true();
+                expect($this->phDi->has('request'))->true();
+                expect($this->phDi->get('request'))->isInstanceOf(Request::class);
+                expect($this->phDi->get('request'))->notSame($this->phDi->get('request'));
+                expect($this->phDi->get('response'))->same($this->phDi->getShared('response'));
+
+                $component = $this->phDi->get('component');
+                expect($component)->isInstanceOf('InjectableComponent');
+                expect($component->getResponse())->same($this->phDi->get('response'));
+                expect($component->other)->equals('other');
+
+                expect($this->phDi->get('closure')->someProperty)->equals('closure');
+
+                $this->phDi->set('request', Request::class);
+            },
+            [
+                'throws' => [
+                    \Phalcon\Di\Exception::class,
+                    "Service 'request' can't be registered because the dependency injection container is frozen"
+                ]
+            ]
+        );
+    }
+
+    /**
+     * Tests resolving lazy services on the first method call
+     */
+    public function testSetLazy()
+    {
+        $this->specify(
+            "Lazy services are resolved before being used",
+            function () {
+                $resolved = 0;
+
+                Proxy::setDirectory(PATH_CACHE);
+
+                $this->phDi->setLazy(
+                    'component',
+                    function () use (&$resolved) {
+                        $resolved++;
+                        return new \InjectableComponent('response');
+                    }
+                );
+
+                $this->phDi->setLazy(
+                    'response',
+                    function () use (&$resolved) {
+                        $resolved++;
+                        return new Response();
+                    },
+                    ResponseInterface::class
+                );
+
+                $component = $this->phDi->getShared('component');
+                $response = $this->phDi->get('response');
+
+                expect($component)->isInstanceOf(Proxy::class);
+                expect($response)->isInstanceOf(ResponseInterface::class);
+                expect($response)->same($this->phDi->getShared('response'));
+                expect($resolved)->equals(0);
+
+                expect($component->getResponse())->equals('response');
+                expect($component->response)->equals('response');
+                expect($resolved)->equals(1);
+
+                $response->setStatusCode(404);
+                expect($response->getStatusCode())->equals(404);
+                expect($response->isProxyResolved())->true();
+                expect($resolved)->equals(2);
+            }
+        );
+    }
+
+    /**
+     * Tests generating the proxies of interfaces
+     */
+    public function testProxyClass()
+    {
+        $this->specify(
+            "Proxies are generated without a directory",
+            function () {
+                Proxy::setDirectory('');
+                Proxy::getProxyClass(\Countable::class);
+            },
+            [
+                'throws' => [
+                    \Phalcon\Di\Exception::class,
+                    'The directory of the proxies must be set with Phalcon\Di\Proxy::setDirectory()'
+                ]
+            ]
+        );
+
+        $this->specify(
+            "Proxies are included from files they didn't generate",
+            function () {
+                Proxy::setDirectory(PATH_CACHE);
+
+                $className = 'PhalconDiProxy_' . md5('countable');
+                file_put_contents(PATH_CACHE . $className . '.php', '<?php throw new \Exception("planted");');
+
+                expect(Proxy::getProxyClass(\Countable::class))->equals($className);
+                expect(class_exists($className, false))->true();
+
+                $source = Proxy::generate(\Countable::class, $className);
+                expect(file_get_contents(PATH_CACHE . $className . '_' . md5($source) . '.php'))->equals($source);
+
+                foreach (glob(PATH_CACHE . $className . '*') as $file) {
+                    unlink($file);
+                }
+            }
+        );
+    }
 }
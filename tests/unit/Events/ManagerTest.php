@@ -252,6 +252,48 @@ class ManagerTest extends UnitTest
         );
     }
 
+    /**
+     * Tests that the compiled listeners are rebuilt when the listeners change
+     *
+     * @test
+     */
+    public function firingAfterChangingListeners()
+    {
+        $this->specify(
+            'The listeners notified by the EventsManager are outdated',
+            function () {
+                $number        = 0;
+                $eventsManager = new Manager();
+
+                $listener = function (Event $event, $component, $data) use (&$number) {
+                    $number++;
+                };
+
+                expect($eventsManager->fire('some-type:beforeSome', $this))->null();
+
+                $eventsManager->attach('some-type', $listener);
+                $eventsManager->fire('some-type:beforeSome', $this);
+                expect($number)->equals(1);
+
+                $eventsManager->attach('some-type:beforeSome', $listener);
+                $eventsManager->fire('some-type:beforeSome', $this);
+                expect($number)->equals(3);
+
+                $eventsManager->detach('some-type', $listener);
+                $eventsManager->fire('some-type:beforeSome', $this);
+                expect($number)->equals(4);
+
+                $eventsManager->detachAll();
+                $eventsManager->fire('some-type:beforeSome', $this);
+                expect($number)->equals(4);
+
+                // Listeners without the method of the event aren't notified
+                $eventsManager->attach('some-type', new FirstListener());
+                expect($eventsManager->fire('some-type:unknownEvent', $this))->null();
+            }
+        );
+    }
+
     public function setLastListener($listener)
     {
         $this->listener = $listener;
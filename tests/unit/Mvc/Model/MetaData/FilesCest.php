@@ -74,4 +74,36 @@ class FilesCest
         $I->deleteFile('meta-phalcon_test_models_robots-robots.php');
         $I->deleteFile('map-phalcon_test_models_robots.php');
     }
+
+    public function snapshot(UnitTester $I)
+    {
+        $I->wantTo('fetch metadata from a snapshot generated by warm up');
+
+        $md = new Files(['metaDataDir' => PATH_CACHE]);
+        $md->setDI($I->getApplication()->getDI());
+        $md->useSnapshot(PATH_CACHE . 'metadata-snapshot.php');
+
+        $snapshot = $md->warmUp([Robots::class]);
+
+        $I->assertEquals($this->data['meta-robots-robots'], $snapshot['metaData']['phalcon\test\models\robots-robots']);
+        $I->assertEquals($this->data['map-robots'], $snapshot['columnMap']['phalcon\test\models\robots']);
+
+        $I->amInPath(PATH_CACHE);
+        $I->seeFileFound('metadata-snapshot.php');
+
+        $I->deleteFile('meta-phalcon_test_models_robots-robots.php');
+        $I->deleteFile('map-phalcon_test_models_robots.php');
+
+        $md = new Files(['metaDataDir' => PATH_CACHE]);
+        $md->useSnapshot(PATH_CACHE . 'metadata-snapshot.php', true);
+
+        $I->assertEquals(
+            $this->data['meta-robots-robots'],
+            $md->readMetaData(new Robots())
+        );
+
+        $I->dontSeeFileFound('meta-phalcon_test_models_robots-robots.php');
+
+        $I->deleteFile('metadata-snapshot.php');
+    }
 }
@@ -0,0 +1,74 @@
+<?php
+
+namespace Phalcon\Test\Unit\Mvc\Model\Query;
+
+use Phalcon\Mvc\Model;
+use Phalcon\Mvc\Model\Manager;
+use Phalcon\Mvc\Model\Query\Lang;
+use Phalcon\Test\Module\UnitTest;
+
+/**
+ * \Phalcon\Test\Unit\Mvc\Model\Query\LangTest
+ * Tests the Phalcon\Mvc\Model\Query\Lang component
+ *
+ * @copyright (c) 2011-2017 Phalcon Team
+ * @link      https://phalconphp.com
+ * @package   Phalcon\Test\Unit\Mvc\Model\Query
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+class LangTest extends UnitTest
+{
+    protected function _after()
+    {
+        Model::setup(['persistentAstCache' => false]);
+        Lang::clearCache();
+
+        parent::_after();
+    }
+
+    public function testPersistentAstCache()
+    {
+        $this->specify(
+            "Persistent AST cache does not reuse parsed statements",
+            function () {
+                if (defined('ZEND_THREAD_SAFE') && ZEND_THREAD_SAFE) {
+                    $this->markTestSkipped('The persistent AST cache is not available in ZTS builds');
+                }
+
+                Model::setup(['persistentAstCache' => true, 'persistentAstCacheSize' => 2]);
+                Lang::clearCache();
+
+                $phql = 'SELECT r.* FROM Robots r WHERE r.id = :id: LIMIT 10';
+                $ast  = Lang::parsePHQL($phql);
+
+                expect(Lang::getCacheStats())->equals(['size' => 1, 'hits' => 0, 'misses' => 1, 'evictions' => 0]);
+
+                /**
+                 * Destroying the models manager destroys the request-scoped AST cache
+                 */
+                $manager = new Manager();
+                unset($manager);
+
+                $cached = Lang::parsePHQL($phql);
+                unset($ast['id'], $cached['id']);
+
+                expect($cached)->equals($ast);
+                expect(Lang::getCacheStats()['hits'])->equals(1);
+
+                Lang::parsePHQL('SELECT * FROM Robots');
+                Lang::parsePHQL('SELECT * FROM Parts');
+
+                $stats = Lang::getCacheStats();
+
+                expect($stats['size'])->equals(2);
+                expect($stats['evictions'])->equals(1);
+            }
+        );
+    }
+}
@@ -3,6 +3,8 @@
 namespace Phalcon\Test\Unit\Mvc\Model;
 
 use Phalcon\DiInterface;
+use Phalcon\Cache\Backend\Memory;
+use Phalcon\Cache\Frontend\Data;
 use Phalcon\Mvc\Model\Query;
 use Phalcon\Test\Module\UnitTest;
 use Phalcon\Test\Models\Deles;
@@ -8128,4 +8130,59 @@ class QueryTest extends UnitTest
             }
         );
     }
+
+    public function testIntermediateCache()
+    {
+        $this->specify(
+            "The intermediate representation is not shared across requests",
+            function () {
+                $cache   = new Memory(new Data(['lifetime' => 3600]));
+                $manager = $this->di->getShared('modelsManager');
+                $phql    = 'SELECT * FROM ' . Robots::class . ' WHERE id > 2';
+
+                $manager->setIntermediateCache($cache, 'v1');
+
+                $query = new Query($phql, $this->di);
+                $expected = $query->parse();
+
+                expect($cache->exists('phql-' . md5('v1:1:' . $phql)))->true();
+
+                /**
+                 * Simulate a new request
+                 */
+                Query::clean();
+
+                $query = new Query($phql, $this->di);
+
+                expect($query->parse())->equals($expected);
+                expect($query->getType())->equals(Query::TYPE_SELECT);
+
+                $manager->setIntermediateCache($cache, 'v2');
+
+                $query = new Query($phql, $this->di);
+                $query->parse();
+
+                expect($cache->exists('phql-' . md5('v2:1:' . $phql)))->true();
+
+                /**
+                 * Simulate a change in the metadata of the models
+                 */
+                $key    = 'phql-' . md5('v2:1:' . $phql);
+                $cached = $cache->get($key);
+
+                expect($cached['models'])->equals([Robots::class]);
+
+                $cache->save($key, array_merge($cached, ['fingerprint' => 'stale', 'intermediate' => []]));
+
+                Query::clean();
+
+                $query = new Query($phql, $this->di);
+
+                expect($query->parse())->equals($expected);
+                expect($cache->get($key))->equals($cached);
+
+                $manager->setIntermediateCache(null);
+            }
+        );
+    }
 }
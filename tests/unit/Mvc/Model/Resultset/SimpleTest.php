@@ -7,6 +7,7 @@ use Phalcon\Test\Models\Robots;
 use Phalcon\Test\Models\People;
 use Helper\ResultsetHelperTrait;
 use Phalcon\Test\Module\UnitTest;
+use Phalcon\Mvc\Model\Exception;
 use Phalcon\Mvc\Model\Resultset\Simple;
 
 /**
@@ -382,4 +383,60 @@ class SimpleTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Work with a streaming Simple Resultset.
+     *
+     * @test
+     */
+    public function shouldStreamResultsetForwardOnly()
+    {
+        $this->specify(
+            'Streaming Simple Resultset does not work as expected',
+            function () {
+                $robots = Robots::find([
+                    'order'  => 'id',
+                    'stream' => true,
+                ]);
+
+                expect($robots)->isInstanceOf(Simple::class);
+                expect($robots->isStream())->true();
+
+                $ids = [];
+                foreach ($robots as $key => $robot) {
+                    expect($robot)->isInstanceOf(Robots::class);
+                    expect($key)->equals(count($ids));
+                    $ids[] = (int) $robot->id;
+                }
+
+                expect($ids)->equals([1, 2, 3]);
+
+                // Streaming resultsets can't go back
+                $robots->rewind();
+            },
+            [
+                'throws' => [
+                    Exception::class,
+                    'Streaming resultsets can only be traversed forward',
+                ],
+            ]
+        );
+
+        $this->specify(
+            'Streaming Simple Resultset can be counted',
+            function () {
+                $robots = Robots::find([
+                    'stream' => true,
+                ]);
+
+                count($robots);
+            },
+            [
+                'throws' => [
+                    Exception::class,
+                    "Streaming resultsets can't be counted",
+                ],
+            ]
+        );
+    }
 }
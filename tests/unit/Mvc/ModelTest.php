@@ -6,8 +6,12 @@ use DateTime;
 use Helper\ModelTrait;
 use Phalcon\Mvc\Model\Message;
 use Phalcon\Test\Models\Users;
+use Phalcon\Di;
 use Phalcon\Cache\Backend\Apc;
+use Phalcon\Cache\Backend\Memory;
+use Phalcon\Test\Models\Parts;
 use Phalcon\Test\Models\Robots;
+use Phalcon\Test\Models\RobotsParts;
 use Phalcon\Mvc\Model\Exception;
 use Phalcon\Cache\Frontend\Data;
 use Phalcon\Test\Models\Boutique;
@@ -671,4 +675,288 @@ class ModelTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests Model::chunkById and Model::lazy
+     */
+    public function testChunkById()
+    {
+        $this->specify(
+            'Records are not iterated in chunks ordered by the primary key',
+            function () {
+                $this->setUpModelsManager();
+
+                $chunks = [];
+                $result = Robots::chunkById(null, 2, function ($robots) use (&$chunks) {
+                    $ids = [];
+                    foreach ($robots as $robot) {
+                        $ids[] = (int) $robot->id;
+                    }
+                    $chunks[] = $ids;
+                });
+
+                expect($result)->true();
+                expect($chunks)->equals([[1, 2], [3]]);
+
+                $chunks = [];
+                $result = Robots::chunkById("type = 'mechanical'", 1, function ($robots) use (&$chunks) {
+                    $chunks[] = (int) $robots->getFirst()->id;
+                    return false;
+                });
+
+                expect($result)->false();
+                expect($chunks)->equals([1]);
+
+                $ids = [];
+                foreach (Robots::lazy("type = 'mechanical'", 1) as $key => $robot) {
+                    expect($robot)->isInstanceOf(Robots::class);
+                    $ids[$key] = (int) $robot->id;
+                }
+
+                expect($ids)->equals([1, 2]);
+            }
+        );
+
+        $this->specify(
+            'Records are not iterated in chunks when the parameters have a cache key',
+            function () {
+                $this->setUpModelsManager();
+
+                Di::getDefault()->setShared('modelsCache', function () {
+                    return new Memory(new Data(['lifetime' => 20]));
+                });
+
+                $parameters = [
+                    'cache' => ['key' => 'robots-chunks'],
+                ];
+
+                $chunks = [];
+                $result = Robots::chunkById($parameters, 2, function ($robots) use (&$chunks) {
+                    $ids = [];
+                    foreach ($robots as $robot) {
+                        $ids[] = (int) $robot->id;
+                    }
+                    $chunks[] = $ids;
+                });
+
+                expect($result)->true();
+                expect($chunks)->equals([[1, 2], [3]]);
+
+                $ids = [];
+                foreach (Robots::lazy($parameters, 2) as $robot) {
+                    $ids[] = (int) $robot->id;
+                }
+
+                expect($ids)->equals([1, 2, 3]);
+            }
+        );
+    }
+
+    /**
+     * Tests eager loading with Model::find
+     */
+    public function testEagerLoading()
+    {
+        $this->specify(
+            'Related records are not eager loaded',
+            function () {
+                $this->setUpModelsManager();
+
+                $robots = Robots::find([
+                    'order' => 'id',
+                    'with'  => ['parts'],
+                ]);
+
+                expect($robots)->isInstanceOf(Simple::class);
+                expect($robots)->count(3);
+
+                $robot = $robots->getFirst();
+                expect($robots->getFirst())->same($robot);
+
+                $parts = $robot->parts;
+                expect($parts)->isInstanceOf(Simple::class);
+                expect($parts)->count(3);
+
+                $ids = [];
+                foreach ($parts as $part) {
+                    expect($part)->isInstanceOf(RobotsParts::class);
+                    expect($part->robots_id)->equals($robot->id);
+                    $ids[] = (int) $part->id;
+                }
+
+                expect($ids)->equals([1, 2, 3]);
+
+                $robot = Robots::findFirst([
+                    'id = 2',
+                    'with' => 'parts',
+                ]);
+
+                expect($robot)->isInstanceOf(Robots::class);
+                expect($robot->parts)->count(0);
+            }
+        );
+
+        $this->specify(
+            'Eager loaded resultsets do not keep the raw rows',
+            function () {
+                $this->setUpModelsManager();
+
+                $robots = Robots::find([
+                    'order' => 'id',
+                    'with'  => 'parts',
+                ]);
+
+                $rows = $robots->toArray(false);
+                expect($rows)->count(3);
+                expect(is_array($rows[0]))->true();
+                expect($rows[0]['name'])->equals('Robotina');
+
+                $parts = $robots->getFirst()->parts->toArray(false);
+                expect($parts)->count(3);
+                expect(is_array($parts[0]))->true();
+
+                $unserialized = unserialize(serialize($robots));
+                expect($unserialized)->count(3);
+                expect($unserialized->getFirst())->isInstanceOf(Robots::class);
+                expect($unserialized->getFirst()->name)->equals('Robotina');
+            }
+        );
+    }
+
+    /**
+     * Tests eager loading nested relations and relations through an intermediate model
+     */
+    public function testEagerLoadingNestedAndManyToMany()
+    {
+        $this->specify(
+            'Nested relations are not eager loaded',
+            function () {
+                $modelsManager = $this->setUpModelsManager();
+
+                $modelsManager->addBelongsTo(new RobotsParts(), 'parts_id', Parts::class, 'id', ['alias' => 'part']);
+
+                $robots = Robots::find([
+                    'order' => 'id',
+                    'with'  => ['parts', 'parts.part'],
+                ]);
+
+                $names = [];
+                foreach ($robots->getFirst()->parts as $robotPart) {
+                    expect($robotPart->part)->isInstanceOf(Parts::class);
+                    expect($robotPart->part->id)->equals($robotPart->parts_id);
+                    $names[] = $robotPart->part->name;
+                }
+
+                expect($names)->equals(['Head', 'Body', 'Arms']);
+            }
+        );
+
+        $this->specify(
+            'Many to many relations are not eager loaded',
+            function () {
+                $modelsManager = $this->setUpModelsManager();
+
+                $modelsManager->addHasManyToMany(
+                    new Robots(),
+                    'id',
+                    RobotsParts::class,
+                    'robots_id',
+                    'parts_id',
+                    Parts::class,
+                    'id',
+                    ['alias' => 'partsThrough']
+                );
+
+                $robots = Robots::find([
+                    'order' => 'id',
+                    'with'  => 'partsThrough',
+                ]);
+
+                expect($robots)->count(3);
+
+                $robot = $robots->getFirst();
+                expect($robot->partsThrough)->isInstanceOf(Simple::class);
+
+                $names = [];
+                foreach ($robot->partsThrough as $part) {
+                    expect($part)->isInstanceOf(Parts::class);
+                    $names[] = $part->name;
+                }
+
+                sort($names);
+                expect($names)->equals(['Arms', 'Body', 'Head']);
+
+                expect($robots->offsetGet(1)->partsThrough)->count(0);
+            }
+        );
+
+        $this->specify(
+            'Limited relations are not eager loaded per record',
+            function () {
+                $modelsManager = $this->setUpModelsManager();
+
+                $modelsManager->addHasMany(
+                    new Robots(),
+                    'id',
+                    RobotsParts::class,
+                    'robots_id',
+                    [
+                        'alias'  => 'limitedParts',
+                        'params' => [
+                            'order' => 'id DESC',
+                            'limit' => 2,
+                        ],
+                    ]
+                );
+
+                $robots = Robots::find([
+                    'order' => 'id',
+                    'with'  => 'limitedParts',
+                ]);
+
+                $ids = [];
+                foreach ($robots->getFirst()->limitedParts as $robotPart) {
+                    $ids[] = (int) $robotPart->id;
+                }
+
+                expect($ids)->equals([3, 2]);
+                expect($robots->offsetGet(1)->limitedParts)->count(0);
+            }
+        );
+    }
+
+    /**
+     * Tests the identity map of the models manager
+     */
+    public function testIdentityMap()
+    {
+        $this->specify(
+            'The identity map does not return the loaded records',
+            function () {
+                $manager = $this->setUpModelsManager();
+                $manager->setIdentityMapSize(2);
+
+                $robot = Robots::findFirst(1);
+                expect($robot)->isInstanceOf(Robots::class);
+                expect(Robots::findFirst(1))->same($robot);
+
+                // Hydrated records are taken from the map too
+                $robots = Robots::find(['order' => 'id']);
+                expect($robots->getFirst())->same($robot);
+
+                // The map keeps only the most recently used records
+                expect(Robots::findFirst(1))->same($robot);
+                Robots::findFirst(2);
+                Robots::findFirst(3);
+                expect(Robots::findFirst(1))->notSame($robot);
+
+                $robot = Robots::findFirst(1);
+                $manager->clearIdentityMap();
+                expect(Robots::findFirst(1))->notSame($robot);
+
+                $manager->setIdentityMapSize(0);
+                expect(Robots::findFirst(1))->notSame(Robots::findFirst(1));
+            }
+        );
+    }
 }
@@ -0,0 +1,71 @@
+<?php
+
+namespace Phalcon\Test\Unit\Mvc\Router;
+
+use Phalcon\Mvc\Router\Route;
+use Phalcon\Mvc\Router\Tree;
+use Phalcon\Test\Module\UnitTest;
+
+/**
+ * \Phalcon\Test\Unit\Mvc\Router\TreeTest
+ * Tests the Phalcon\Mvc\Router\Tree component
+ *
+ * @copyright (c) 2011-2017 Phalcon Team
+ * @link      https://phalconphp.com
+ * @package   Phalcon\Test\Unit\Mvc\Router
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+class TreeTest extends UnitTest
+{
+    public function testStaticPrefix()
+    {
+        $this->specify(
+            "Static prefixes are not extracted correctly",
+            function ($pattern, $expected) {
+                expect(Tree::getStaticPrefix($pattern))->equals($expected);
+            },
+            [
+                'examples' => [
+                    ['/about',                                  ''],
+                    ['#^/admin/users/([0-9]+)$#u',              '/admin/users/'],
+                    ['#^/posts/(\d+)$#u',                       '/posts/'],
+                    ['#^/items?/([0-9]+)$#u',                   '/item'],
+                    ['#^/manual\.html$#u',                      '/manual'],
+                    ['#^/ab{2}$#u',                             '/a'],
+                    ['#^/blog(/.*)*$#u',                        '/blog'],
+                    ['#^/admin/users$#i',                       ''],
+                    ['#^/first|/second$#u',                     ''],
+                    ['#^/lang/(en|es)/home$#u',                 '/lang/'],
+                    ['#^/([\w0-9\_\-]+)[/]{0,1}$#u',            '/'],
+                ],
+            ]
+        );
+    }
+
+    public function testCandidates()
+    {
+        $this->specify(
+            "Candidate routes are not selected correctly",
+            function () {
+                $tree = new Tree([
+                    new Route('/about'),
+                    new Route('/admin/users/{id:[0-9]+}'),
+                    new Route('/admin/:controller'),
+                    new Route('/blog/{slug}'),
+                    new Route('/{language:[a-z]{2}}/:controller'),
+                ]);
+
+                expect($tree->getCandidates('/about'))->equals([0, 4]);
+                expect($tree->getCandidates('/admin/users/10'))->equals([1, 2, 4]);
+                expect($tree->getCandidates('/blog/hello'))->equals([3, 4]);
+                expect($tree->getCandidates('/unknown'))->equals([4]);
+            }
+        );
+    }
+}
@@ -253,6 +253,89 @@ class RouterTest extends UnitTest
         );
     }
 
+    /**
+     * Tests matching routes selected by the static prefix tree
+     */
+    public function testMatchingWithTheRouterTree()
+    {
+        $this->specify(
+            'Router does not matched correctly by using the prefix tree',
+            function ($uri, $controller, $action, $params) {
+                $router = $this->getRouter();
+
+                $router->useTree(true);
+                $this->addMatchingRoutes($router);
+
+                $router->handle($uri);
+
+                expect($router->getControllerName())->equals($controller);
+                expect($router->getActionName())->equals($action);
+                expect($router->getParams())->equals($params);
+            },
+            [
+                'examples' => $this->routerProvider()
+            ]
+        );
+    }
+
+    /**
+     * Tests exporting and importing the compiled routes
+     */
+    public function testExportingAndImportingRoutes()
+    {
+        $this->specify(
+            'Router does not import the exported routes correctly',
+            function () {
+                $router = $this->getRouter(false);
+
+                $router->useTree(true);
+                $router->add('/robots/{id:[0-9]+}', 'Robots::show')
+                    ->setName('show-robot')
+                    ->convert('id', 'intval');
+                $router->addPost('/robots', 'Robots::save');
+
+                $exported = $router->export();
+
+                Route::reset();
+
+                $imported = $this->getRouter(false);
+                $imported->import($exported);
+
+                expect($imported->getRouteByName('show-robot')->getCompiledPattern())
+                    ->equals('#^/robots/([0-9]+)$#u');
+
+                $imported->handle('/robots/10');
+
+                expect($imported->wasMatched())->true();
+                expect($imported->getControllerName())->equals('robots');
+                expect($imported->getParams())->same(['id' => 10]);
+
+                $route = $imported->add('/parts', 'Parts::index');
+
+                expect($route->getRouteId())->equals(2);
+            }
+        );
+
+        $this->specify(
+            'Router exports routes with closures',
+            function () {
+                $router = $this->getRouter(false);
+
+                $router->add('/robots/{id:[0-9]+}', 'Robots::show')
+                    ->convert('id', function ($id) {
+                        return (int) $id;
+                    });
+
+                $router->export();
+            },
+            [
+                'throws' => [
+                    Router\Exception::class
+                ]
+            ]
+        );
+    }
+
     /**
      * Tests router by using http method
      *
@@ -923,6 +1006,63 @@ class RouterTest extends UnitTest
         ];
     }
 
+    protected function addMatchingRoutes(Router $router)
+    {
+        $router->add('/', [
+            'controller' => 'index',
+            'action' => 'index'
+        ]);
+
+        $router->add('/system/:controller/a/:action/:params', [
+            'controller' => 1,
+            'action' => 2,
+            'params' => 3,
+        ]);
+
+        $router->add('/([a-z]{2})/:controller', [
+            'controller' => 2,
+            'action' => 'index',
+            'language' => 1
+        ]);
+
+        $router->add('/admin/:controller/:action/:int', [
+            'controller' => 1,
+            'action' => 2,
+            'id' => 3
+        ]);
+
+        $router->add('/posts/([0-9]{4})/([0-9]{2})/([0-9]{2})/:params', [
+            'controller' => 'posts',
+            'action' => 'show',
+            'year' => 1,
+            'month' => 2,
+            'day' => 3,
+            'params' => 4,
+        ]);
+
+        $router->add('/manual/([a-z]{2})/([a-z\.]+)\.html', [
+            'controller' => 'manual',
+            'action' => 'show',
+            'language' => 1,
+            'file' => 2
+        ]);
+
+        $router->add('/named-manual/{language:([a-z]{2})}/{file:[a-z\.]+}\.html', [
+            'controller' => 'manual',
+            'action' => 'show',
+        ]);
+
+        $router->add('/very/static/route', [
+            'controller' => 'static',
+            'action' => 'route'
+        ]);
+
+        $router->add('/feed/{lang:[a-z]+}/blog/{blog:[a-z\-]+}\.{type:[a-z\-]+}', 'Feed::get');
+        $router->add('/posts/{year:[0-9]+}/s/{title:[a-z\-]+}', 'Posts::show');
+        $router->add('/posts/delete/{id}', 'Posts::delete');
+        $router->add('/show/{id:video([0-9]+)}/{title:[a-z\-]+}', 'Videos::show');
+    }
+
     protected function getRouter($defaultRoutes = true)
     {
         $router = new Router($defaultRoutes);
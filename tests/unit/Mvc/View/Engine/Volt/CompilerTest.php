@@ -1212,6 +1212,12 @@ class CompilerTest extends UnitTest
                 $compilation = $volt->compileString('{% cache somekey 500 %} hello {% endcache %}');
                 expect($compilation)->equals('<?php $_cache[$somekey] = $this->di->get(\'viewCache\'); $_cacheKey[$somekey] = $_cache[$somekey]->start($somekey, 500); if ($_cacheKey[$somekey] === null) { ?> hello <?php $_cache[$somekey]->save($somekey, null, 500); } else { echo $_cacheKey[$somekey]; } ?>');
 
+                $compilation = $volt->compileString('{% cache "sidebar" tags ["user:5", "catalog"] %} hello {% endcache %}');
+                expect($compilation)->equals('<?php $_cache[\'sidebar\'] = $this->di->get(\'viewCache\'); $_cacheTaggedKey[\'sidebar\'] = $_cache[\'sidebar\']->getTaggedKey(\'sidebar\', [\'user:5\', \'catalog\']); $_cacheKey[\'sidebar\'] = $_cache[\'sidebar\']->start($_cacheTaggedKey[\'sidebar\']); if ($_cacheKey[\'sidebar\'] === null) { ?> hello <?php $_cache[\'sidebar\']->save($_cacheTaggedKey[\'sidebar\']); } else { echo $_cacheKey[\'sidebar\']; } ?>');
+
+                $compilation = $volt->compileString('{% cache somekey 500 tags [tag] %} hello {% endcache %}');
+                expect($compilation)->equals('<?php $_cache[$somekey] = $this->di->get(\'viewCache\'); $_cacheTaggedKey[$somekey] = $_cache[$somekey]->getTaggedKey($somekey, [$tag]); $_cacheKey[$somekey] = $_cache[$somekey]->start($_cacheTaggedKey[$somekey], 500); if ($_cacheKey[$somekey] === null) { ?> hello <?php $_cache[$somekey]->save($_cacheTaggedKey[$somekey], null, 500); } else { echo $_cacheKey[$somekey]; } ?>');
+
                 //Autoescape mode
                 $compilation = $volt->compileString(
                     '{{ "hello" }}{% autoescape true %}{{ "hello" }}{% autoescape false %}{{ "hello" }}{% endautoescape %}{{ "hello" }}{% endautoescape %}{{ "hello" }}'
@@ -1649,6 +1655,219 @@ FORM;
         );
     }
 
+    /**
+     * Tests compiling a template while another process holds its lock
+     */
+    public function testVoltCompileLock()
+    {
+        $this->specify(
+            "Volt doesn't use the stale template while another process compiles it",
+            function () {
+                $template = PATH_DATA . 'views/layouts/test10.volt';
+                $compiled = PATH_CACHE . 'test10.volt.php';
+
+                $this->removeFiles([$compiled, $compiled . '.lock']);
+
+                $volt = new Compiler();
+                $volt->setOptions(
+                    [
+                        'compiledPath' => function () use ($compiled) {
+                            return $compiled;
+                        },
+                    ]
+                );
+
+                Compiler::resetCompileStats();
+
+                $volt->compile($template);
+                $volt->compile($template);
+
+                $stats = Compiler::getCompileStats();
+                expect($stats['compiled'])->equals(1);
+                expect($stats['stale'])->equals(0);
+                expect(file_exists($compiled . '.lock'))->false();
+
+                // The template changed and another process is compiling it
+                file_put_contents($compiled, 'stale');
+                touch($compiled, filemtime($template) - 3600);
+
+                $handle = fopen($compiled . '.lock', 'c');
+                flock($handle, LOCK_EX);
+
+                $volt->compile($template);
+
+                flock($handle, LOCK_UN);
+                fclose($handle);
+
+                $stats = Compiler::getCompileStats();
+                expect($stats['compiled'])->equals(1);
+                expect($stats['stale'])->equals(1);
+                expect(file_get_contents($compiled))->equals('stale');
+
+                $volt->compile($template);
+
+                expect(Compiler::getCompileStats()['compiled'])->equals(2);
+                expect(file_get_contents($compiled))->notEquals('stale');
+                expect(glob($compiled . '.*'))->isEmpty();
+
+                $this->removeFiles([$compiled, $compiled . '.lock']);
+            }
+        );
+    }
+
+    /**
+     * Tests recompiling a template when the template it extends changes
+     */
+    public function testVoltCompileDependencies()
+    {
+        $this->specify(
+            "Volt doesn't recompile templates whose parent changed",
+            function () {
+                $viewsDir = PATH_CACHE . 'volt-dependencies/';
+                $compiledDir = PATH_CACHE . 'volt-compiled/';
+
+                @mkdir($viewsDir);
+                @mkdir($compiledDir);
+
+                file_put_contents($viewsDir . 'parent.volt', '{% block content %}parent{% endblock %}');
+                file_put_contents($viewsDir . 'child.volt', '{% extends "parent.volt" %}{% block content %}child{% endblock %}');
+                touch($viewsDir . 'parent.volt', time() - 3600);
+                touch($viewsDir . 'child.volt', time() - 3600);
+
+                $view = new View();
+                $view->setViewsDir($viewsDir);
+
+                $volt = new Compiler($view);
+                $volt->setOptions(['compiledPath' => $compiledDir]);
+
+                Compiler::resetCompileStats();
+
+                $volt->compile($viewsDir . 'child.volt');
+                expect($volt->getDependencies())->equals([$viewsDir . 'parent.volt']);
+
+                $volt->compile($viewsDir . 'child.volt');
+                expect(Compiler::getCompileStats()['compiled'])->equals(2);
+
+                touch($viewsDir . 'parent.volt', time() + 10);
+                clearstatcache();
+
+                $volt->compile($viewsDir . 'child.volt');
+                expect(Compiler::getCompileStats()['compiled'])->equals(4);
+
+                $templates = $volt->compileDirectory($viewsDir);
+                expect($templates)->equals([$viewsDir . 'child.volt', $viewsDir . 'parent.volt']);
+
+                $this->removeFiles(array_merge(glob($viewsDir . '*'), glob($compiledDir . '*')));
+                @rmdir($viewsDir);
+                @rmdir($compiledDir);
+            }
+        );
+    }
+
+    /**
+     * Tests reporting the templates that child processes couldn't compile
+     */
+    public function testVoltCompileDirectoryProcesses()
+    {
+        if (!function_exists('pcntl_fork')) {
+            $this->markTestSkipped('Warning: pcntl extension is not loaded');
+        }
+
+        $this->specify(
+            "Volt doesn't report the templates that failed in child processes",
+            function () {
+                $viewsDir = PATH_CACHE . 'volt-processes/';
+                $compiledDir = PATH_CACHE . 'volt-processes-compiled/';
+
+                @mkdir($viewsDir);
+                @mkdir($compiledDir);
+
+                file_put_contents($viewsDir . 'a.volt', '{{ "valid" }}');
+                file_put_contents($viewsDir . 'b.volt', '{{ "valid" }}');
+
+                $volt = new Compiler();
+                $volt->setOptions(['compiledPath' => $compiledDir]);
+
+                expect($volt->compileDirectory($viewsDir, 2))->equals([$viewsDir . 'a.volt', $viewsDir . 'b.volt']);
+                expect(glob($compiledDir . '*.php'))->count(2);
+
+                // The second chunk is compiled by a child process
+                file_put_contents($viewsDir . 'b.volt', '{{');
+
+                $failed = false;
+                try {
+                    $volt->compileDirectory($viewsDir, 2);
+                } catch (\Phalcon\Mvc\View\Exception $e) {
+                    $failed = true;
+                }
+
+                expect($failed)->true();
+
+                $this->removeFiles(array_merge(glob($viewsDir . '*'), glob($compiledDir . '*')));
+                @rmdir($viewsDir);
+                @rmdir($compiledDir);
+            }
+        );
+    }
+
+    /**
+     * Tests storing the blocks of templates compiled in extends mode as PHP arrays
+     */
+    public function testVoltCompileExtendsMode()
+    {
+        $this->specify(
+            "Volt doesn't read the blocks of templates compiled in extends mode",
+            function () {
+                $compiled = PATH_CACHE . 'parent.volt%%e%%.php';
+
+                $volt = new Compiler();
+                $volt->setOptions(
+                    [
+                        'compiledPath' => function () use ($compiled) {
+                            return $compiled;
+                        },
+                    ]
+                );
+
+                $blocks = $volt->compile(PATH_DATA . 'views/test10/parent.volt', true);
+
+                expect(is_array($blocks))->true();
+                expect(file_get_contents($compiled))->startsWith('<?php return array');
+                expect(require $compiled)->equals($blocks);
+
+                // The blocks are read from the compiled file
+                touch($compiled, filemtime(PATH_DATA . 'views/test10/parent.volt') + 10);
+                clearstatcache();
+
+                expect($volt->compile(PATH_DATA . 'views/test10/parent.volt', true))->equals($blocks);
+
+                // Files compiled by previous versions
+                file_put_contents($compiled, serialize($blocks));
+                touch($compiled, filemtime(PATH_DATA . 'views/test10/parent.volt') + 10);
+                clearstatcache();
+
+                expect($volt->compile(PATH_DATA . 'views/test10/parent.volt', true))->equals($blocks);
+
+                // Serialized blocks with PHP code aren't executed
+                $legacy = [
+                    '<?php echo \'legacy\'; ?>',
+                    '<?php foreach ($items as $item) { ?><?= $item ?><?php } ?>',
+                ];
+
+                file_put_contents($compiled, serialize($legacy));
+                touch($compiled, filemtime(PATH_DATA . 'views/test10/parent.volt') + 10);
+                clearstatcache();
+
+                ob_start();
+                $read = $volt->compile(PATH_DATA . 'views/test10/parent.volt', true);
+                expect(ob_get_clean())->isEmpty();
+                expect($read)->equals($legacy);
+
+                $this->removeFiles([$compiled, $compiled . '.lock']);
+            }
+        );
+    }
+
     protected function removeFiles($files)
     {
         if (!is_array($files)) {
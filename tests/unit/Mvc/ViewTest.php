@@ -599,6 +599,75 @@ class ViewTest extends UnitTest
     }
 
 
+    /**
+     * Tests writing the render levels directly to the output
+     */
+    public function testStreamRender()
+    {
+        $this->specify(
+            'The View component does not stream the render levels in order',
+            function () {
+                $view = new View;
+                $view->setViewsDir(PATH_DATA . 'views' . DIRECTORY_SEPARATOR);
+                $view->stream();
+
+                expect($view->isStreaming())->true();
+
+                ob_start();
+                $view->start();
+                $view->render('test3', 'other');
+                $view->finish();
+                expect(ob_get_clean())->equals("<html>lolhere</html>\n");
+
+                $view->setTemplateAfter('test');
+
+                ob_start();
+                $view->start();
+                echo 'controller';
+                $view->render('test3', 'other');
+                $view->finish();
+                expect(ob_get_clean())->equals("<html>zuplolhere</html>\n");
+
+                $view->cleanTemplateAfter();
+                $view->setRenderLevel(View::LEVEL_LAYOUT);
+
+                ob_start();
+                $view->start();
+                $view->render('test3', 'other');
+                $view->finish();
+                expect(ob_get_clean())->equals('lolhere');
+
+                $view->setRenderLevel(View::LEVEL_NO_RENDER);
+
+                ob_start();
+                $view->start();
+                echo 'controller';
+                $view->render('test3', 'other');
+                $view->finish();
+                expect(ob_get_clean())->equals('controller');
+                expect($view->getContent())->equals('');
+            }
+        );
+
+        $this->specify(
+            'The View component streams the render levels with the view cache enabled',
+            function () {
+                $view = new View;
+                $view->setViewsDir(PATH_DATA . 'views' . DIRECTORY_SEPARATOR);
+                $view->stream();
+                $view->cache(true);
+
+                $view->render('test3', 'other');
+            },
+            [
+                'throws' => [
+                    Exception::class,
+                    "The view cache can't be used in the streaming render mode"
+                ]
+            ]
+        );
+    }
+
     /**
      * Tests View::setMainView
      *
@@ -106,4 +106,38 @@ class RedisTest extends UnitTest
             }
         );
     }
+
+    /**
+     * Tests the keys tracking of sessions
+     */
+    public function testLeanSession()
+    {
+        $this->specify(
+            "The session doesn't keep the given stats key",
+            function () {
+                $session = new Redis(
+                    [
+                        "host" => TEST_RS_HOST,
+                        "port" => TEST_RS_PORT
+                    ]
+                );
+
+                $options = $session->getRedis()->getOptions();
+                expect($options["lean"])->true();
+                expect($options["statsKey"])->equals("");
+
+                $session = new Redis(
+                    [
+                        "host"     => TEST_RS_HOST,
+                        "port"     => TEST_RS_PORT,
+                        "statsKey" => "_PHCR_SESSIONS"
+                    ]
+                );
+
+                $options = $session->getRedis()->getOptions();
+                expect($options["lean"])->false();
+                expect($options["statsKey"])->equals("_PHCR_SESSIONS");
+            }
+        );
+    }
 }